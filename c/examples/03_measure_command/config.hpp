@@ -6,6 +6,7 @@
 
 #include <tirex_tracker.h>
 
+#include <cstdint>
 #include <map>
 #include <memory>
 #include <string>
@@ -34,7 +35,8 @@ namespace tirex {
 
 	struct MeasureCmdArgs final {
 		LoggerConf logConf;
-		std::string command;   /**< The command that should be measured **/
+		std::string command;		/**< The command that should be measured **/
+		std::vector<uint32_t> pids; /**< Already running processes that should be measured instead **/
 		std::string formatter; /**< The identifier specifying the formatter to use for the output **/
 		std::vector<std::string> statproviders;
 		size_t pollIntervalMs;
@@ -46,7 +46,106 @@ static const char* measureToName[] = {
 		/*[TIREX_GIT_REMOTE_ORIGIN] =*/"git remote origin",
 		/*[TIREX_GIT_UNCOMMITTED_CHANGES] =*/"git uncommitted changes",
 		/*[TIREX_GIT_UNPUSHED_CHANGES] =*/"git unpushed changes",
-		/*[TIREX_GIT_UNCHECKED_FILES] =*/"git unchecked files"
+		/*[TIREX_GIT_UNCHECKED_FILES] =*/"git unchecked files",
+		/*[TIREX_CPU_NUM_THREADS_PROCESS] =*/"cpu num threads process",
+		/*[TIREX_CPU_USED_THREADS_PERCENT] =*/"cpu used threads percent",
+		/*[TIREX_CPU_TIME_THREADS_MS] =*/"cpu time threads ms",
+		/*[TIREX_CPU_THREADS_IMBALANCE] =*/"cpu threads imbalance",
+		/*[TIREX_CPU_USED_CORES_PERCENT] =*/"cpu used cores percent",
+		/*[TIREX_CPU_FREQUENCY_CORES_MHZ] =*/"cpu frequency cores mhz",
+		/*[TIREX_CPU_ACTIVE_CORES_SYSTEM] =*/"cpu active cores system",
+		/*[TIREX_PERF_CYCLES] =*/"perf cycles",
+		/*[TIREX_PERF_INSTRUCTIONS] =*/"perf instructions",
+		/*[TIREX_PERF_CACHE_REFERENCES] =*/"perf cache references",
+		/*[TIREX_PERF_CACHE_MISSES] =*/"perf cache misses",
+		/*[TIREX_PERF_BRANCH_MISSES] =*/"perf branch misses",
+		/*[TIREX_PERF_CONTEXT_SWITCHES] =*/"perf context switches",
+		/*[TIREX_PERF_CPU_MIGRATIONS] =*/"perf cpu migrations",
+		/*[TIREX_PERF_PAGE_FAULTS] =*/"perf page faults",
+		/*[TIREX_PERF_IPC] =*/"perf ipc",
+		/*[TIREX_PERF_CACHE_MISS_PERCENT] =*/"perf cache miss percent",
+		/*[TIREX_IO_READ_PROCESS_BYTES] =*/"io read process bytes",
+		/*[TIREX_IO_WRITTEN_PROCESS_BYTES] =*/"io written process bytes",
+		/*[TIREX_IO_STORAGE_READ_PROCESS_BYTES] =*/"io storage read process bytes",
+		/*[TIREX_IO_STORAGE_WRITTEN_PROCESS_BYTES] =*/"io storage written process bytes",
+		/*[TIREX_IO_READ_CALLS_PROCESS] =*/"io read calls process",
+		/*[TIREX_IO_WRITE_CALLS_PROCESS] =*/"io write calls process",
+		/*[TIREX_IO_READ_RATE_PROCESS_KBPS] =*/"io read rate process kbps",
+		/*[TIREX_IO_WRITE_RATE_PROCESS_KBPS] =*/"io write rate process kbps",
+		/*[TIREX_IO_STORAGE_READ_RATE_PROCESS_KBPS] =*/"io storage read rate process kbps",
+		/*[TIREX_IO_STORAGE_WRITE_RATE_PROCESS_KBPS] =*/"io storage write rate process kbps",
+		/*[TIREX_PSI_CPU_SOME_PERMYRIAD] =*/"psi cpu some permyriad",
+		/*[TIREX_PSI_CPU_FULL_PERMYRIAD] =*/"psi cpu full permyriad",
+		/*[TIREX_PSI_MEMORY_SOME_PERMYRIAD] =*/"psi memory some permyriad",
+		/*[TIREX_PSI_MEMORY_FULL_PERMYRIAD] =*/"psi memory full permyriad",
+		/*[TIREX_PSI_IO_SOME_PERMYRIAD] =*/"psi io some permyriad",
+		/*[TIREX_PSI_IO_FULL_PERMYRIAD] =*/"psi io full permyriad",
+		/*[TIREX_PSI_CPU_SOME_STALL_MS] =*/"psi cpu some stall ms",
+		/*[TIREX_PSI_CPU_FULL_STALL_MS] =*/"psi cpu full stall ms",
+		/*[TIREX_PSI_MEMORY_SOME_STALL_MS] =*/"psi memory some stall ms",
+		/*[TIREX_PSI_MEMORY_FULL_STALL_MS] =*/"psi memory full stall ms",
+		/*[TIREX_PSI_IO_SOME_STALL_MS] =*/"psi io some stall ms",
+		/*[TIREX_PSI_IO_FULL_STALL_MS] =*/"psi io full stall ms",
+		/*[TIREX_RAM_PSS_PROCESS_KB] =*/"ram pss process kb",
+		/*[TIREX_RAM_USS_PROCESS_KB] =*/"ram uss process kb",
+		/*[TIREX_RAM_ANON_PROCESS_KB] =*/"ram anon process kb",
+		/*[TIREX_RAM_FILE_PROCESS_KB] =*/"ram file process kb",
+		/*[TIREX_RAM_SHMEM_PROCESS_KB] =*/"ram shmem process kb",
+		/*[TIREX_RAM_SWAP_PROCESS_KB] =*/"ram swap process kb",
+		/*[TIREX_RAM_HUGEPAGES_PROCESS_KB] =*/"ram hugepages process kb",
+		/*[TIREX_PAGECACHE_START] =*/"pagecache start",
+		/*[TIREX_PAGECACHE_STOP] =*/"pagecache stop",
+		/*[TIREX_PAGECACHE_RESIDENT_PERCENT] =*/"pagecache resident percent",
+		/*[TIREX_PAGECACHE_STATE] =*/"pagecache state",
+		/*[TIREX_CPU_USED_PIDS_PERCENT] =*/"cpu used pids percent",
+		/*[TIREX_RAM_USED_PIDS_KB] =*/"ram used pids kb",
+		/*[TIREX_PROCESS_TIMELINE] =*/"process timeline",
+		/*[TIREX_PROCESS_COUNT] =*/"process count",
+		/*[TIREX_CPU_IDLE_STATES] =*/"cpu idle states",
+		/*[TIREX_CPU_IDLE_PERCENT] =*/"cpu idle percent",
+		/*[TIREX_CPU_THROTTLE_EVENTS] =*/"cpu throttle events",
+		/*[TIREX_THERMAL_ZONES_CELSIUS] =*/"thermal zones celsius",
+		/*[TIREX_CPU_RUN_TIME_PROCESS_MS] =*/"cpu run time process ms",
+		/*[TIREX_CPU_WAIT_TIME_PROCESS_MS] =*/"cpu wait time process ms",
+		/*[TIREX_CPU_TIMESLICES_PROCESS] =*/"cpu timeslices process",
+		/*[TIREX_CPU_WAIT_PROCESS_PERCENT] =*/"cpu wait process percent",
+		/*[TIREX_IO_BLOCK_DELAY_PROCESS_MS] =*/"io block delay process ms",
+		/*[TIREX_ENERGY_DOMAINS_JOULES] =*/"energy domains joules",
+		/*[TIREX_POWER_DOMAINS_WATTS] =*/"power domains watts",
+		/*[TIREX_CPU_ENERGY_PROCESS_JOULES] =*/"cpu energy process joules",
+		/*[TIREX_RAM_ENERGY_PROCESS_JOULES] =*/"ram energy process joules",
+		/*[TIREX_CPU_ENERGY_ESTIMATED_JOULES] =*/"cpu energy estimated joules",
+		/*[TIREX_CPU_POWER_ESTIMATED_WATTS] =*/"cpu power estimated watts",
+		/*[TIREX_CPU_POWER_MODEL] =*/"cpu power model",
+		/*[TIREX_GPU_USED_DEVICES_PERCENT] =*/"gpu used devices percent",
+		/*[TIREX_GPU_USED_PROCESS_DEVICES_PERCENT] =*/"gpu used process devices percent",
+		/*[TIREX_GPU_VRAM_USED_DEVICES_MB] =*/"gpu vram used devices mb",
+		/*[TIREX_GPU_VRAM_USED_PROCESS_DEVICES_MB] =*/"gpu vram used process devices mb",
+		/*[TIREX_GPU_USED_SAMPLES_PERCENT] =*/"gpu used samples percent",
+		/*[TIREX_GPU_MEMORY_USED_SAMPLES_PERCENT] =*/"gpu memory used samples percent",
+		/*[TIREX_GPU_POWER_SAMPLES_WATTS] =*/"gpu power samples watts",
+		/*[TIREX_GPU_CLOCK_SM_MHZ] =*/"gpu clock sm mhz",
+		/*[TIREX_GPU_CLOCK_MEMORY_MHZ] =*/"gpu clock memory mhz",
+		/*[TIREX_GPU_POWER_WATTS] =*/"gpu power watts",
+		/*[TIREX_GPU_TEMPERATURE_CELSIUS] =*/"gpu temperature celsius",
+		/*[TIREX_GPU_MEMORY_TEMPERATURE_CELSIUS] =*/"gpu memory temperature celsius",
+		/*[TIREX_GPU_PCIE_TX_KBPS] =*/"gpu pcie tx kbps",
+		/*[TIREX_GPU_PCIE_RX_KBPS] =*/"gpu pcie rx kbps",
+		/*[TIREX_GPU_THROTTLE_REASONS] =*/"gpu throttle reasons",
+		/*[TIREX_GIT_CHANGED_DURING_RUN] =*/"git changed during run",
+		/*[TIREX_CPU_CORE_TYPES] =*/"cpu core types",
+		/*[TIREX_CPU_CACHE_TOPOLOGY] =*/"cpu cache topology",
+		/*[TIREX_CPU_NUMA_NODES] =*/"cpu numa nodes",
+		/*[TIREX_CPU_USED_CORE_TYPES_PERCENT] =*/"cpu used core types percent",
+		/*[TIREX_PSI_CPU_SOME_AVG10_PERMYRIAD] =*/"psi cpu some avg10 permyriad",
+		/*[TIREX_PSI_CPU_FULL_AVG10_PERMYRIAD] =*/"psi cpu full avg10 permyriad",
+		/*[TIREX_PSI_MEMORY_SOME_AVG10_PERMYRIAD] =*/"psi memory some avg10 permyriad",
+		/*[TIREX_PSI_MEMORY_FULL_AVG10_PERMYRIAD] =*/"psi memory full avg10 permyriad",
+		/*[TIREX_PSI_IO_SOME_AVG10_PERMYRIAD] =*/"psi io some avg10 permyriad",
+		/*[TIREX_PSI_IO_FULL_AVG10_PERMYRIAD] =*/"psi io full avg10 permyriad",
+		/*[TIREX_CPU_RUN_TIME_STEPS_PROCESS_MS] =*/"cpu run time steps process ms",
+		/*[TIREX_CPU_WAIT_TIME_STEPS_PROCESS_MS] =*/"cpu wait time steps process ms",
+		/*[TIREX_CPU_TIMESLICES_STEPS_PROCESS] =*/"cpu timeslices steps process"
 };
 
 /* SIMPLE FORMATTER */
@@ -6,6 +6,10 @@
 
 #include <CLI/CLI.hpp>
 
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <csignal>
 #include <cstdlib>
 #include <future>
 #include <iostream>
@@ -23,7 +27,8 @@ static std::map<std::string, std::vector<tirexMeasureConf>> confGroups = {
 		  {TIREX_GIT_REMOTE_ORIGIN, TIREX_AGG_NO},
 		  {TIREX_GIT_UNCOMMITTED_CHANGES, TIREX_AGG_NO},
 		  {TIREX_GIT_UNPUSHED_CHANGES, TIREX_AGG_NO},
-		  {TIREX_GIT_UNCHECKED_FILES, TIREX_AGG_NO}}},
+		  {TIREX_GIT_UNCHECKED_FILES, TIREX_AGG_NO},
+		  {TIREX_GIT_CHANGED_DURING_RUN, TIREX_AGG_NO}}},
 		{"system",
 		 {{TIREX_OS_NAME, TIREX_AGG_NO},
 		  {TIREX_OS_KERNEL, TIREX_AGG_NO},
@@ -47,11 +52,27 @@ static std::map<std::string, std::vector<tirexMeasureConf>> confGroups = {
 		  {TIREX_CPU_VIRTUALIZATION, TIREX_AGG_NO},
 		  {TIREX_RAM_USED_PROCESS_KB, TIREX_AGG_NO},
 		  {TIREX_RAM_USED_SYSTEM_MB, TIREX_AGG_NO},
-		  {TIREX_RAM_AVAILABLE_SYSTEM_MB, TIREX_AGG_NO}}},
+		  {TIREX_RAM_AVAILABLE_SYSTEM_MB, TIREX_AGG_NO},
+		  {TIREX_CPU_USED_CORES_PERCENT, TIREX_AGG_NO},
+		  {TIREX_CPU_FREQUENCY_CORES_MHZ, TIREX_AGG_NO},
+		  {TIREX_CPU_ACTIVE_CORES_SYSTEM, TIREX_AGG_NO},
+		  {TIREX_CPU_USED_PIDS_PERCENT, TIREX_AGG_NO},
+		  {TIREX_RAM_USED_PIDS_KB, TIREX_AGG_NO},
+		  {TIREX_CPU_CORE_TYPES, TIREX_AGG_NO},
+		  {TIREX_CPU_CACHE_TOPOLOGY, TIREX_AGG_NO},
+		  {TIREX_CPU_NUMA_NODES, TIREX_AGG_NO},
+		  {TIREX_CPU_USED_CORE_TYPES_PERCENT, TIREX_AGG_NO}}},
 		{"energy",
 		 {{TIREX_CPU_ENERGY_SYSTEM_JOULES, TIREX_AGG_NO},
 		  {TIREX_RAM_ENERGY_SYSTEM_JOULES, TIREX_AGG_NO},
-		  {TIREX_GPU_ENERGY_SYSTEM_JOULES, TIREX_AGG_NO}}},
+		  {TIREX_GPU_ENERGY_SYSTEM_JOULES, TIREX_AGG_NO},
+		  {TIREX_ENERGY_DOMAINS_JOULES, TIREX_AGG_NO},
+		  {TIREX_POWER_DOMAINS_WATTS, TIREX_AGG_NO},
+		  {TIREX_CPU_ENERGY_PROCESS_JOULES, TIREX_AGG_NO},
+		  {TIREX_RAM_ENERGY_PROCESS_JOULES, TIREX_AGG_NO},
+		  {TIREX_CPU_ENERGY_ESTIMATED_JOULES, TIREX_AGG_NO},
+		  {TIREX_CPU_POWER_ESTIMATED_WATTS, TIREX_AGG_NO},
+		  {TIREX_CPU_POWER_MODEL, TIREX_AGG_NO}}},
 		{"gpu",
 		 {{TIREX_GPU_SUPPORTED, TIREX_AGG_NO},
 		  {TIREX_GPU_MODEL_NAME, TIREX_AGG_NO},
@@ -60,7 +81,98 @@ static std::map<std::string, std::vector<tirexMeasureConf>> confGroups = {
 		  {TIREX_GPU_USED_SYSTEM_PERCENT, TIREX_AGG_NO},
 		  {TIREX_GPU_VRAM_USED_PROCESS_MB, TIREX_AGG_NO},
 		  {TIREX_GPU_VRAM_USED_SYSTEM_MB, TIREX_AGG_NO},
-		  {TIREX_GPU_VRAM_AVAILABLE_SYSTEM_MB, TIREX_AGG_NO}}}
+		  {TIREX_GPU_VRAM_AVAILABLE_SYSTEM_MB, TIREX_AGG_NO},
+		  {TIREX_GPU_USED_DEVICES_PERCENT, TIREX_AGG_NO},
+		  {TIREX_GPU_USED_PROCESS_DEVICES_PERCENT, TIREX_AGG_NO},
+		  {TIREX_GPU_VRAM_USED_DEVICES_MB, TIREX_AGG_NO},
+		  {TIREX_GPU_VRAM_USED_PROCESS_DEVICES_MB, TIREX_AGG_NO},
+		  {TIREX_GPU_USED_SAMPLES_PERCENT, TIREX_AGG_NO},
+		  {TIREX_GPU_MEMORY_USED_SAMPLES_PERCENT, TIREX_AGG_NO},
+		  {TIREX_GPU_POWER_SAMPLES_WATTS, TIREX_AGG_NO},
+		  {TIREX_GPU_CLOCK_SM_MHZ, TIREX_AGG_NO},
+		  {TIREX_GPU_CLOCK_MEMORY_MHZ, TIREX_AGG_NO},
+		  {TIREX_GPU_POWER_WATTS, TIREX_AGG_NO},
+		  {TIREX_GPU_TEMPERATURE_CELSIUS, TIREX_AGG_NO},
+		  {TIREX_GPU_MEMORY_TEMPERATURE_CELSIUS, TIREX_AGG_NO},
+		  {TIREX_GPU_PCIE_TX_KBPS, TIREX_AGG_NO},
+		  {TIREX_GPU_PCIE_RX_KBPS, TIREX_AGG_NO},
+		  {TIREX_GPU_THROTTLE_REASONS, TIREX_AGG_NO}}},
+		{"threads",
+		 {{TIREX_CPU_NUM_THREADS_PROCESS, TIREX_AGG_NO},
+		  {TIREX_CPU_USED_THREADS_PERCENT, TIREX_AGG_NO},
+		  {TIREX_CPU_TIME_THREADS_MS, TIREX_AGG_NO},
+		  {TIREX_CPU_THREADS_IMBALANCE, TIREX_AGG_NO}}},
+		{"perf",
+		 {{TIREX_PERF_CYCLES, TIREX_AGG_NO},
+		  {TIREX_PERF_INSTRUCTIONS, TIREX_AGG_NO},
+		  {TIREX_PERF_CACHE_REFERENCES, TIREX_AGG_NO},
+		  {TIREX_PERF_CACHE_MISSES, TIREX_AGG_NO},
+		  {TIREX_PERF_BRANCH_MISSES, TIREX_AGG_NO},
+		  {TIREX_PERF_CONTEXT_SWITCHES, TIREX_AGG_NO},
+		  {TIREX_PERF_CPU_MIGRATIONS, TIREX_AGG_NO},
+		  {TIREX_PERF_PAGE_FAULTS, TIREX_AGG_NO},
+		  {TIREX_PERF_IPC, TIREX_AGG_NO},
+		  {TIREX_PERF_CACHE_MISS_PERCENT, TIREX_AGG_NO}}},
+		{"io",
+		 {{TIREX_IO_READ_PROCESS_BYTES, TIREX_AGG_NO},
+		  {TIREX_IO_WRITTEN_PROCESS_BYTES, TIREX_AGG_NO},
+		  {TIREX_IO_STORAGE_READ_PROCESS_BYTES, TIREX_AGG_NO},
+		  {TIREX_IO_STORAGE_WRITTEN_PROCESS_BYTES, TIREX_AGG_NO},
+		  {TIREX_IO_READ_CALLS_PROCESS, TIREX_AGG_NO},
+		  {TIREX_IO_WRITE_CALLS_PROCESS, TIREX_AGG_NO},
+		  {TIREX_IO_READ_RATE_PROCESS_KBPS, TIREX_AGG_NO},
+		  {TIREX_IO_WRITE_RATE_PROCESS_KBPS, TIREX_AGG_NO},
+		  {TIREX_IO_STORAGE_READ_RATE_PROCESS_KBPS, TIREX_AGG_NO},
+		  {TIREX_IO_STORAGE_WRITE_RATE_PROCESS_KBPS, TIREX_AGG_NO}}},
+		{"pressure",
+		 {{TIREX_PSI_CPU_SOME_PERMYRIAD, TIREX_AGG_NO},
+		  {TIREX_PSI_CPU_FULL_PERMYRIAD, TIREX_AGG_NO},
+		  {TIREX_PSI_MEMORY_SOME_PERMYRIAD, TIREX_AGG_NO},
+		  {TIREX_PSI_MEMORY_FULL_PERMYRIAD, TIREX_AGG_NO},
+		  {TIREX_PSI_IO_SOME_PERMYRIAD, TIREX_AGG_NO},
+		  {TIREX_PSI_IO_FULL_PERMYRIAD, TIREX_AGG_NO},
+		  {TIREX_PSI_CPU_SOME_STALL_MS, TIREX_AGG_NO},
+		  {TIREX_PSI_CPU_FULL_STALL_MS, TIREX_AGG_NO},
+		  {TIREX_PSI_MEMORY_SOME_STALL_MS, TIREX_AGG_NO},
+		  {TIREX_PSI_MEMORY_FULL_STALL_MS, TIREX_AGG_NO},
+		  {TIREX_PSI_IO_SOME_STALL_MS, TIREX_AGG_NO},
+		  {TIREX_PSI_IO_FULL_STALL_MS, TIREX_AGG_NO},
+		  {TIREX_PSI_CPU_SOME_AVG10_PERMYRIAD, TIREX_AGG_NO},
+		  {TIREX_PSI_CPU_FULL_AVG10_PERMYRIAD, TIREX_AGG_NO},
+		  {TIREX_PSI_MEMORY_SOME_AVG10_PERMYRIAD, TIREX_AGG_NO},
+		  {TIREX_PSI_MEMORY_FULL_AVG10_PERMYRIAD, TIREX_AGG_NO},
+		  {TIREX_PSI_IO_SOME_AVG10_PERMYRIAD, TIREX_AGG_NO},
+		  {TIREX_PSI_IO_FULL_AVG10_PERMYRIAD, TIREX_AGG_NO}}},
+		{"memory",
+		 {{TIREX_RAM_PSS_PROCESS_KB, TIREX_AGG_NO},
+		  {TIREX_RAM_USS_PROCESS_KB, TIREX_AGG_NO},
+		  {TIREX_RAM_ANON_PROCESS_KB, TIREX_AGG_NO},
+		  {TIREX_RAM_FILE_PROCESS_KB, TIREX_AGG_NO},
+		  {TIREX_RAM_SHMEM_PROCESS_KB, TIREX_AGG_NO},
+		  {TIREX_RAM_SWAP_PROCESS_KB, TIREX_AGG_NO},
+		  {TIREX_RAM_HUGEPAGES_PROCESS_KB, TIREX_AGG_NO}}},
+		{"pagecache",
+		 {{TIREX_PAGECACHE_START, TIREX_AGG_NO},
+		  {TIREX_PAGECACHE_STOP, TIREX_AGG_NO},
+		  {TIREX_PAGECACHE_RESIDENT_PERCENT, TIREX_AGG_NO},
+		  {TIREX_PAGECACHE_STATE, TIREX_AGG_NO}}},
+		{"processes",
+		 {{TIREX_PROCESS_TIMELINE, TIREX_AGG_NO},
+		  {TIREX_PROCESS_COUNT, TIREX_AGG_NO}}},
+		{"thermal",
+		 {{TIREX_CPU_IDLE_STATES, TIREX_AGG_NO},
+		  {TIREX_CPU_IDLE_PERCENT, TIREX_AGG_NO},
+		  {TIREX_CPU_THROTTLE_EVENTS, TIREX_AGG_NO},
+		  {TIREX_THERMAL_ZONES_CELSIUS, TIREX_AGG_NO}}},
+		{"scheduler",
+		 {{TIREX_CPU_RUN_TIME_PROCESS_MS, TIREX_AGG_NO},
+		  {TIREX_CPU_WAIT_TIME_PROCESS_MS, TIREX_AGG_NO},
+		  {TIREX_CPU_TIMESLICES_PROCESS, TIREX_AGG_NO},
+		  {TIREX_CPU_WAIT_PROCESS_PERCENT, TIREX_AGG_NO},
+		  {TIREX_IO_BLOCK_DELAY_PROCESS_MS, TIREX_AGG_NO},
+		  {TIREX_CPU_RUN_TIME_STEPS_PROCESS_MS, TIREX_AGG_NO},
+		  {TIREX_CPU_WAIT_TIME_STEPS_PROCESS_MS, TIREX_AGG_NO},
+		  {TIREX_CPU_TIMESLICES_STEPS_PROCESS, TIREX_AGG_NO}}}
 };
 
 static void logCallback(tirexLogLevel level, const char* component, const char* message) {
@@ -85,11 +197,27 @@ static void setupLoggerArgs(CLI::App& app, tirex::LoggerConf& conf) {
 	app.add_flag("-q,--quiet", conf.quiet, "Supresses all outputs");
 }
 
+static std::atomic<bool> interrupted = false;
+
+/**
+ * @brief Blocks until all of the given processes exited or the user interrupts (Ctrl+C) the measurement.
+ */
+static void waitForProcesses(const std::vector<uint32_t>& pids, size_t pollIntervalMs) {
+	std::signal(SIGINT, [](int) { interrupted = true; });
+	auto anyRunning = [&pids]() { return std::ranges::any_of(pids, isProcessRunning); };
+	while (!interrupted && anyRunning())
+		std::this_thread::sleep_for(std::chrono::milliseconds{pollIntervalMs});
+	std::signal(SIGINT, SIG_DFL);
+}
+
 static void runMeasureCmd(const MeasureCmdArgs& args) {
 	// Initialization and setup
 	tirex::setVerbosity(args.logConf.getVerbosity());
 	auto logger = tirex::getLogger("measure");
-	logger->info("Measuring command: {}", args.command);
+	if (!args.command.empty())
+		logger->info("Measuring command: {}", args.command);
+	for (auto pid : args.pids)
+		logger->info("Measuring process: {}", pid);
 
 	// Start measuring
 	std::vector<tirexMeasureConf> measures;
@@ -100,11 +228,16 @@ static void runMeasureCmd(const MeasureCmdArgs& args) {
 	measures.emplace_back(tirexNullConf);
 
 	tirexMeasureHandle* handle;
-	tirexError err = tirexStartTracking(measures.data(), args.pollIntervalMs, &handle);
+	tirexError err =
+			tirexStartTrackingPids(measures.data(), args.pids.data(), args.pids.size(), args.pollIntervalMs, &handle);
 	assert(err == TIREX_SUCCESS);
 
-	// Run the command
-	auto exitcode = std::system(args.command.c_str());
+	// Run the command or, if only processes to attach to were given, wait until they are done
+	if (!args.command.empty()) {
+		auto exitcode = std::system(args.command.c_str());
+	} else {
+		waitForProcesses(args.pids, args.pollIntervalMs);
+	}
 
 	// Stop measuring
 	tirexResult* result;
@@ -125,7 +258,13 @@ int main(int argc, char* argv[]) {
 
 	MeasureCmdArgs measureArgs;
 	setupLoggerArgs(app, measureArgs.logConf);
-	app.add_option("command", measureArgs.command, "The command to measure resources for")->required();
+	app.add_option("command", measureArgs.command, "The command to measure resources for");
+	app.add_option("--pid,-p", measureArgs.pids)
+			->description(
+					"The ID of an already running process to measure (can be passed multiple times). The command, if "
+					"any, is then run but not measured. Without a command, the measurement stops once all processes "
+					"exited or on Ctrl+C."
+			);
 	app.add_option("--format,-f", measureArgs.formatter, "Specified how the output should be formatted")
 			->default_val("simple");
 	app.add_option("--source,-s", measureArgs.statproviders, "The datasources to poll information from")
@@ -139,7 +278,11 @@ int main(int argc, char* argv[]) {
 	app.add_flag("--pedantic", measureArgs.pedantic, "If set, measure will stop execution on errors")
 			->default_val(false); /** \todo support pedantic **/
 
-	app.callback([&measureArgs]() { runMeasureCmd(measureArgs); });
+	app.callback([&measureArgs]() {
+		if (measureArgs.command.empty() && measureArgs.pids.empty())
+			throw CLI::RequiredError("command or --pid");
+		runMeasureCmd(measureArgs);
+	});
 
 	CLI11_PARSE(app, argc, argv);
 	return 0;
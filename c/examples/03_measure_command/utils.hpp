@@ -5,9 +5,17 @@
 
 #include <tirex_tracker.h>
 
+#include <cstdint>
 #include <string>
 #include <vector>
 
+#if defined(_WIN32)
+#include <windows.h>
+#else
+#include <cerrno>
+#include <signal.h>
+#endif
+
 #if defined(__GNUC__)
 #if defined(__clang__)
 static constexpr const char* compiler = "clang " __VERSION__;
@@ -37,4 +45,21 @@ static std::string buildVersionString() {
 	return versionString;
 }
 
+/**
+ * @brief Returns true if the process with the given ID is still running.
+ */
+static bool isProcessRunning(uint32_t pid) {
+#if defined(_WIN32)
+	auto process = OpenProcess(SYNCHRONIZE, FALSE, pid);
+	if (process == nullptr)
+		return false;
+	auto running = WaitForSingleObject(process, 0) == WAIT_TIMEOUT;
+	CloseHandle(process);
+	return running;
+#else
+	// Signal 0 only checks whether the process exists; EPERM means that it exists but belongs to another user
+	return kill(static_cast<pid_t>(pid), 0) == 0 || errno == EPERM;
+#endif
+}
+
 #endif
\ No newline at end of file
@@ -60,13 +60,13 @@ typedef enum tirexMeasure_enum {
 	 */
 	TIREX_TIME_ELAPSED_WALL_CLOCK_MS = 2,
 	/**
-	 * @brief Measure the time in milliseconds that the program spend in user mode between tirexStartTracking and
-	 * tirexStopTracking (Measurement).
+	 * @brief Measure the time in milliseconds that the tracked processes and their children spend in user mode between
+	 * tirexStartTracking and tirexStopTracking (Measurement).
 	 */
 	TIREX_TIME_ELAPSED_USER_MS = 3,
 	/**
-	 * @brief Measure the time in milliseconds that the program spend in kernel mode between tirexStartTracking and
-	 * tirexStopTracking (Measurement).
+	 * @brief Measure the time in milliseconds that the tracked processes and their children spend in kernel mode
+	 * between tirexStartTracking and tirexStopTracking (Measurement).
 	 */
 	TIREX_TIME_ELAPSED_SYSTEM_MS = 4,
 
@@ -114,6 +114,242 @@ typedef enum tirexMeasure_enum {
 	TIREX_GIT_UNPUSHED_CHANGES = 42,
 	TIREX_GIT_UNCHECKED_FILES = 43,
 
+	/** @brief Number of threads of the tracked process and its children over time (Time Series). */
+	TIREX_CPU_NUM_THREADS_PROCESS = 44,
+	/**
+	 * @brief CPU usage of each thread of the tracked process and its children in percent of a single logical core
+	 * (Time Series per thread).
+	 */
+	TIREX_CPU_USED_THREADS_PERCENT = 45,
+	/** @brief CPU time in milliseconds that each thread spent between tirexStartTracking and tirexStopTracking. */
+	TIREX_CPU_TIME_THREADS_MS = 46,
+	/** @brief Summary of how evenly the CPU time was distributed across the threads (Measurement). */
+	TIREX_CPU_THREADS_IMBALANCE = 47,
+
+	/** @brief CPU usage of each logical core in percent (Time Series per core). */
+	TIREX_CPU_USED_CORES_PERCENT = 48,
+	/** @brief Current frequency of each logical core in megahertz (Time Series per core). */
+	TIREX_CPU_FREQUENCY_CORES_MHZ = 49,
+	/** @brief Number of logical cores that were busy for at least half of each polling interval (Time Series). */
+	TIREX_CPU_ACTIVE_CORES_SYSTEM = 50,
+
+	/** @brief Number of CPU cycles spent by the tracked process tree (hardware counter). */
+	TIREX_PERF_CYCLES = 51,
+	/** @brief Number of instructions retired by the tracked process tree (hardware counter). */
+	TIREX_PERF_INSTRUCTIONS = 52,
+	/** @brief Number of cache references of the tracked process tree (hardware counter). */
+	TIREX_PERF_CACHE_REFERENCES = 53,
+	/** @brief Number of cache misses of the tracked process tree (hardware counter). */
+	TIREX_PERF_CACHE_MISSES = 54,
+	/** @brief Number of mispredicted branches of the tracked process tree (hardware counter). */
+	TIREX_PERF_BRANCH_MISSES = 55,
+	/** @brief Number of context switches of the tracked process tree (software counter). */
+	TIREX_PERF_CONTEXT_SWITCHES = 56,
+	/** @brief Number of times the tracked process tree migrated between CPUs (software counter). */
+	TIREX_PERF_CPU_MIGRATIONS = 57,
+	/** @brief Number of page faults of the tracked process tree (software counter). */
+	TIREX_PERF_PAGE_FAULTS = 58,
+	/** @brief Instructions per cycle of the tracked process tree. */
+	TIREX_PERF_IPC = 59,
+	/** @brief Percentage of cache references of the tracked process tree that missed the cache. */
+	TIREX_PERF_CACHE_MISS_PERCENT = 60,
+
+	/** @brief Bytes read by the tracked process tree using read-like system calls. */
+	TIREX_IO_READ_PROCESS_BYTES = 61,
+	/** @brief Bytes written by the tracked process tree using write-like system calls. */
+	TIREX_IO_WRITTEN_PROCESS_BYTES = 62,
+	/** @brief Bytes the tracked process tree caused to be fetched from storage. */
+	TIREX_IO_STORAGE_READ_PROCESS_BYTES = 63,
+	/** @brief Bytes the tracked process tree caused to be sent to storage. */
+	TIREX_IO_STORAGE_WRITTEN_PROCESS_BYTES = 64,
+	/** @brief Number of read-like system calls of the tracked process tree. */
+	TIREX_IO_READ_CALLS_PROCESS = 65,
+	/** @brief Number of write-like system calls of the tracked process tree. */
+	TIREX_IO_WRITE_CALLS_PROCESS = 66,
+	/** @brief Read throughput of the tracked process tree in kilobytes per second (Time Series). */
+	TIREX_IO_READ_RATE_PROCESS_KBPS = 67,
+	/** @brief Write throughput of the tracked process tree in kilobytes per second (Time Series). */
+	TIREX_IO_WRITE_RATE_PROCESS_KBPS = 68,
+	/** @brief Storage read throughput of the tracked process tree in kilobytes per second (Time Series). */
+	TIREX_IO_STORAGE_READ_RATE_PROCESS_KBPS = 69,
+	/** @brief Storage write throughput of the tracked process tree in kilobytes per second (Time Series). */
+	TIREX_IO_STORAGE_WRITE_RATE_PROCESS_KBPS = 70,
+
+	/** @brief Share of each step in which at least one task was stalled waiting for a CPU in 0.01 % (Time Series). */
+	TIREX_PSI_CPU_SOME_PERMYRIAD = 71,
+	/** @brief Share of each step in which all non-idle tasks were stalled waiting for a CPU in 0.01 % (Time Series). */
+	TIREX_PSI_CPU_FULL_PERMYRIAD = 72,
+	/** @brief Share of each step in which at least one task was stalled waiting for memory in 0.01 % (Time Series). */
+	TIREX_PSI_MEMORY_SOME_PERMYRIAD = 73,
+	/**
+	 * @brief Share of each step in which all non-idle tasks were stalled waiting for memory in 0.01 % (Time Series).
+	 */
+	TIREX_PSI_MEMORY_FULL_PERMYRIAD = 74,
+	/** @brief Share of each step in which at least one task was stalled waiting for I/O in 0.01 % (Time Series). */
+	TIREX_PSI_IO_SOME_PERMYRIAD = 75,
+	/** @brief Share of each step in which all non-idle tasks were stalled waiting for I/O in 0.01 % (Time Series). */
+	TIREX_PSI_IO_FULL_PERMYRIAD = 76,
+	/** @brief Time in milliseconds in which at least one task was stalled waiting for a CPU. */
+	TIREX_PSI_CPU_SOME_STALL_MS = 77,
+	/** @brief Time in milliseconds in which all non-idle tasks were stalled waiting for a CPU. */
+	TIREX_PSI_CPU_FULL_STALL_MS = 78,
+	/** @brief Time in milliseconds in which at least one task was stalled waiting for memory. */
+	TIREX_PSI_MEMORY_SOME_STALL_MS = 79,
+	/** @brief Time in milliseconds in which all non-idle tasks were stalled waiting for memory. */
+	TIREX_PSI_MEMORY_FULL_STALL_MS = 80,
+	/** @brief Time in milliseconds in which at least one task was stalled waiting for I/O. */
+	TIREX_PSI_IO_SOME_STALL_MS = 81,
+	/** @brief Time in milliseconds in which all non-idle tasks were stalled waiting for I/O. */
+	TIREX_PSI_IO_FULL_STALL_MS = 82,
+
+	/** @brief Proportional set size (PSS) of the tracked process tree in kilobytes (Time Series). */
+	TIREX_RAM_PSS_PROCESS_KB = 83,
+	/** @brief Unique set size (USS) of the tracked process tree in kilobytes (Time Series). */
+	TIREX_RAM_USS_PROCESS_KB = 84,
+	/** @brief Resident anonymous memory (e.g., heap) of the tracked process tree in kilobytes (Time Series). */
+	TIREX_RAM_ANON_PROCESS_KB = 85,
+	/** @brief Resident file-backed memory of the tracked process tree in kilobytes (Time Series). */
+	TIREX_RAM_FILE_PROCESS_KB = 86,
+	/** @brief Resident shared memory of the tracked process tree in kilobytes (Time Series). */
+	TIREX_RAM_SHMEM_PROCESS_KB = 87,
+	/** @brief Swapped out memory of the tracked process tree in kilobytes (Time Series). */
+	TIREX_RAM_SWAP_PROCESS_KB = 88,
+	/**
+	 * @brief Anonymous memory backed by transparent huge pages of the tracked process tree in kilobytes (Time Series).
+	 */
+	TIREX_RAM_HUGEPAGES_PROCESS_KB = 89,
+
+	/** @brief Page cache residency of the declared input files when tracking started. */
+	TIREX_PAGECACHE_START = 90,
+	/** @brief Page cache residency of the declared input files when tracking stopped. */
+	TIREX_PAGECACHE_STOP = 91,
+	/** @brief Share of the declared input files that is resident in the page cache in percent (Time Series). */
+	TIREX_PAGECACHE_RESIDENT_PERCENT = 92,
+	/** @brief Page cache state of the declared input files when tracking started (warm, cold or partial). */
+	TIREX_PAGECACHE_STATE = 93,
+
+	/** @brief The CPU utilization of each tracked process and its children in percent (100 = one logical core). */
+	TIREX_CPU_USED_PIDS_PERCENT = 94,
+	/** @brief The RAM used by each tracked process and its children in kilobytes. */
+	TIREX_RAM_USED_PIDS_KB = 95,
+
+	/** @brief A timeline of all processes that were part of the tracked process trees. */
+	TIREX_PROCESS_TIMELINE = 96,
+	/** @brief The number of processes that were part of the tracked process trees. */
+	TIREX_PROCESS_COUNT = 97,
+
+	/** @brief The residency in and number of entries into each CPU idle state (C-state) while tracking. */
+	TIREX_CPU_IDLE_STATES = 98,
+	/** @brief The share of the CPU time that was spent in any idle state in percent (only if enabled). */
+	TIREX_CPU_IDLE_PERCENT = 99,
+	/** @brief How often and for how long the CPU cores and packages were throttled due to their temperature. */
+	TIREX_CPU_THROTTLE_EVENTS = 100,
+	/** @brief The temperature of each thermal zone in degrees Celsius. */
+	TIREX_THERMAL_ZONES_CELSIUS = 101,
+
+	/** @brief The time the threads of the process and its children spent running on a CPU in milliseconds. */
+	TIREX_CPU_RUN_TIME_PROCESS_MS = 102,
+	/** @brief The time the threads of the process and its children spent waiting on a run queue in milliseconds. */
+	TIREX_CPU_WAIT_TIME_PROCESS_MS = 103,
+	/** @brief The number of timeslices the threads of the process and its children ran on a CPU. */
+	TIREX_CPU_TIMESLICES_PROCESS = 104,
+	/** @brief The share of the runnable time the threads of the process spent waiting for a CPU in percent. */
+	TIREX_CPU_WAIT_PROCESS_PERCENT = 105,
+	/** @brief The time the threads of the process and its children were blocked on block I/O in milliseconds. */
+	TIREX_IO_BLOCK_DELAY_PROCESS_MS = 106,
+
+	/** @brief The energy consumed by each RAPL domain (package, core, uncore, dram, psys) in joules. */
+	TIREX_ENERGY_DOMAINS_JOULES = 107,
+	/** @brief The average power drawn by each RAPL domain since the last polling step in watts. */
+	TIREX_POWER_DOMAINS_WATTS = 108,
+
+	/**
+	 * @brief The CPU package energy attributed to the process and its children by their share of the CPU time in joules.
+	 */
+	TIREX_CPU_ENERGY_PROCESS_JOULES = 109,
+	/** @brief The DRAM energy attributed to the process and its children by their share of the CPU time in joules. */
+	TIREX_RAM_ENERGY_PROCESS_JOULES = 110,
+
+	/**
+	 * @brief The energy consumed by the CPUs as estimated from their utilization and frequency using a power model in joules.
+	 */
+	TIREX_CPU_ENERGY_ESTIMATED_JOULES = 111,
+	/** @brief The power drawn by the CPUs as estimated using a power model in watts. */
+	TIREX_CPU_POWER_ESTIMATED_WATTS = 112,
+	/** @brief The parameters of the power model used to estimate the energy consumed by the CPUs. */
+	TIREX_CPU_POWER_MODEL = 113,
+
+	/** @brief GPU utilization of the entire system in percent per GPU. */
+	TIREX_GPU_USED_DEVICES_PERCENT = 114,
+	/** @brief SM utilization caused by the tracked process and its children in percent per GPU. */
+	TIREX_GPU_USED_PROCESS_DEVICES_PERCENT = 115,
+	/** @brief GPU VRAM usage of the entire system in megabytes per GPU. */
+	TIREX_GPU_VRAM_USED_DEVICES_MB = 116,
+	/** @brief GPU VRAM usage of the tracked process and its children in megabytes per GPU. */
+	TIREX_GPU_VRAM_USED_PROCESS_DEVICES_MB = 117,
+
+	/**
+	 * @brief GPU utilization of the entire system in percent per GPU at the driver's sampling rate (only if enabled).
+	 */
+	TIREX_GPU_USED_SAMPLES_PERCENT = 118,
+	/**
+	 * @brief GPU memory controller utilization in percent per GPU at the driver's sampling rate (only if enabled).
+	 */
+	TIREX_GPU_MEMORY_USED_SAMPLES_PERCENT = 119,
+	/** @brief Power drawn by each GPU in watts at the driver's sampling rate (only if enabled). */
+	TIREX_GPU_POWER_SAMPLES_WATTS = 120,
+
+	/** @brief SM clock of each GPU in MHz. */
+	TIREX_GPU_CLOCK_SM_MHZ = 121,
+	/** @brief Memory clock of each GPU in MHz. */
+	TIREX_GPU_CLOCK_MEMORY_MHZ = 122,
+	/** @brief Power drawn by each GPU in watts. */
+	TIREX_GPU_POWER_WATTS = 123,
+	/** @brief Temperature of each GPU in degrees Celsius. */
+	TIREX_GPU_TEMPERATURE_CELSIUS = 124,
+	/** @brief Memory temperature of each GPU in degrees Celsius (if supported). */
+	TIREX_GPU_MEMORY_TEMPERATURE_CELSIUS = 125,
+	/** @brief PCIe transmit throughput of each GPU in KB/s. */
+	TIREX_GPU_PCIE_TX_KBPS = 126,
+	/** @brief PCIe receive throughput of each GPU in KB/s. */
+	TIREX_GPU_PCIE_RX_KBPS = 127,
+	/** @brief Why the clocks of each GPU were reduced. */
+	TIREX_GPU_THROTTLE_REASONS = 128,
+
+	/** @brief Whether HEAD, the index or any of the hashed files changed while tracking (0 or 1). */
+	TIREX_GIT_CHANGED_DURING_RUN = 129,
+
+	/** @brief The kinds of CPU cores (e.g., performance and efficiency cores) with their processors. */
+	TIREX_CPU_CORE_TYPES = 130,
+	/** @brief The size of each instance of each CPU cache level and how many logical processors share it. */
+	TIREX_CPU_CACHE_TOPOLOGY = 131,
+	/** @brief The NUMA nodes with their logical processors and memory (Linux only). */
+	TIREX_CPU_NUMA_NODES = 132,
+	/** @brief CPU usage of each kind of core in percent (Time Series, Linux only). */
+	TIREX_CPU_USED_CORE_TYPES_PERCENT = 133,
+
+	/** @brief The kernel's 10 second average of TIREX_PSI_CPU_SOME_PERMYRIAD in 0.01 % (Time Series). */
+	TIREX_PSI_CPU_SOME_AVG10_PERMYRIAD = 134,
+	/** @brief The kernel's 10 second average of TIREX_PSI_CPU_FULL_PERMYRIAD in 0.01 % (Time Series). */
+	TIREX_PSI_CPU_FULL_AVG10_PERMYRIAD = 135,
+	/** @brief The kernel's 10 second average of TIREX_PSI_MEMORY_SOME_PERMYRIAD in 0.01 % (Time Series). */
+	TIREX_PSI_MEMORY_SOME_AVG10_PERMYRIAD = 136,
+	/** @brief The kernel's 10 second average of TIREX_PSI_MEMORY_FULL_PERMYRIAD in 0.01 % (Time Series). */
+	TIREX_PSI_MEMORY_FULL_AVG10_PERMYRIAD = 137,
+	/** @brief The kernel's 10 second average of TIREX_PSI_IO_SOME_PERMYRIAD in 0.01 % (Time Series). */
+	TIREX_PSI_IO_SOME_AVG10_PERMYRIAD = 138,
+	/** @brief The kernel's 10 second average of TIREX_PSI_IO_FULL_PERMYRIAD in 0.01 % (Time Series). */
+	TIREX_PSI_IO_FULL_AVG10_PERMYRIAD = 139,
+
+	/** @brief The time the threads of the process and its children ran on a CPU in each step in ms (Time Series). */
+	TIREX_CPU_RUN_TIME_STEPS_PROCESS_MS = 140,
+	/**
+	 * @brief The time the threads of the process and its children waited for a CPU in each step in ms (Time Series).
+	 */
+	TIREX_CPU_WAIT_TIME_STEPS_PROCESS_MS = 141,
+	/** @brief The number of timeslices the threads of the process and its children ran in each step (Time Series). */
+	TIREX_CPU_TIMESLICES_STEPS_PROCESS = 142,
+
 	/**
 	 * @brief The total number of supported measures.
 	 * @details It can be assumed that every number in the range `[0, TIREX_MEASURE_COUNT]` is a valid enum value.
@@ -235,6 +471,29 @@ TIREX_EXPORT tirexError tirexFetchInfo(const tirexMeasureConf* measures, tirexRe
 TIREX_EXPORT tirexError
 tirexStartTracking(const tirexMeasureConf* measures, size_t pollIntervalMs, tirexMeasureHandle** handle);
 
+/**
+ * @brief Like tirexStartTracking but measures the given (already running) processes and their children instead of the
+ * calling process.
+ * @details The per-process measures (e.g., TIREX_CPU_USED_PROCESS_PERCENT) are aggregated over all given processes.
+ * Some measures are additionally reported for each process on its own (e.g., TIREX_CPU_USED_PIDS_PERCENT). Processes
+ * that exit during the measurement are accounted until they exit. Note that not all platforms support tracking more
+ * than one process.
+ * 
+ * @param measures 
+ * @param pids The IDs of the processes to be tracked.
+ * @param numPids The number of entries in \p pids. If it is zero, the calling process is tracked.
+ * @param pollIntervalMs 
+ * @param[out] handle a handle to the running measurement.
+ * @return TIREX_SUCCESS on success or TIREX_INVALID_ARGUMENT if one of the processes does not exist or cannot be
+ * tracked (e.g., since it belongs to another user).
+ * 
+ * @see tirexStopTracking
+ */
+TIREX_EXPORT tirexError tirexStartTrackingPids(
+		const tirexMeasureConf* measures, const uint32_t* pids, size_t numPids, size_t pollIntervalMs,
+		tirexMeasureHandle** handle
+);
+
 /**
  * @brief Stops the measurement and deinitializes the data providers.
  * @details This function **must** be called **exactly once** for each measurement job.
@@ -1,7 +1,9 @@
 #ifndef MEASURE_MEASURE_HPP
 #define MEASURE_MEASURE_HPP
 
+#include <algorithm>
 #include <chrono>
+#include <string>
 #include <utility>
 #include <vector>
 
@@ -16,12 +18,15 @@ namespace tirex {
 		T max;
 		T min;
 		T avg;
+		size_t count;
+		double total;
 		std::vector<std::chrono::milliseconds> timepoints;
 		std::vector<T> values;
 
 	public:
 		TimeSeries(bool storeSeries)
-				: storeSeries(storeSeries), starttime(clock::now()), max(), min(), avg(), timepoints(), values() {}
+				: storeSeries(storeSeries), starttime(clock::now()), max(), min(), avg(), count(0), total(0),
+				  timepoints(), values() {}
 
 		void addValue(const T& value) noexcept {
 			if (storeSeries) {
@@ -29,9 +34,11 @@ namespace tirex {
 				);
 				values.emplace_back(value);
 			}
-			max = std::max(max, value);
-			min = std::min(min, value);
-			/** \todo update average **/
+			max = (count == 0) ? value : std::max(max, value);
+			min = (count == 0) ? value : std::min(min, value);
+			total += static_cast<double>(value);
+			++count;
+			avg = static_cast<T>(total / count);
 		}
 		void reset() {
 			timepoints.clear();
@@ -46,6 +53,61 @@ namespace tirex {
 			return {timepoints, values};
 		}
 	};
+
+	/**
+	 * @brief A group of time series that share their timestamps (e.g., one series per CPU core or per thread).
+	 * @details Each series (column) is identified by a label. Columns may be added at any point in time, in which case
+	 * their values for earlier steps are reported as zero. The values are stored row-wise, i.e., one row per step.
+	 */
+	template <typename T>
+	struct TimeSeriesMatrix final {
+		using clock = std::chrono::high_resolution_clock;
+
+	private:
+		const clock::time_point starttime;
+		std::vector<std::string> labels;
+		std::vector<std::chrono::milliseconds> timepoints;
+		std::vector<std::vector<T>> rows;
+
+	public:
+		TimeSeriesMatrix() : starttime(clock::now()), labels(), timepoints(), rows() {}
+		explicit TimeSeriesMatrix(std::vector<std::string> labels)
+				: starttime(clock::now()), labels(std::move(labels)), timepoints(), rows() {}
+
+		/**
+		 * @brief Returns the index of the column with the given label and adds a new column if none exists yet.
+		 */
+		size_t column(const std::string& label) {
+			auto it = std::find(labels.begin(), labels.end(), label);
+			if (it != labels.end())
+				return static_cast<size_t>(it - labels.begin());
+			labels.emplace_back(label);
+			return labels.size() - 1;
+		}
+
+		/**
+		 * @brief Appends a row of values for the current point in time. The i-th value belongs to the i-th column.
+		 */
+		void addRow(std::vector<T>&& row) noexcept { addRow(std::move(row), clock::now()); }
+		/**
+		 * @brief Appends a row of values that were sampled at the given point in time (e.g., by a device driver).
+		 */
+		void addRow(std::vector<T>&& row, clock::time_point time) noexcept {
+			timepoints.emplace_back(std::chrono::duration_cast<std::chrono::milliseconds>(time - starttime));
+			rows.emplace_back(std::move(row));
+		}
+		void reset() {
+			timepoints.clear();
+			rows.clear();
+		}
+
+		size_t numColumns() const noexcept { return labels.size(); }
+		const std::vector<std::string>& columnLabels() const noexcept { return labels; }
+		const std::pair<const std::vector<std::chrono::milliseconds>&, const std::vector<std::vector<T>>&>
+		timeseries() const noexcept {
+			return {timepoints, rows};
+		}
+	};
 }; // namespace tirex
 
 #endif
\ No newline at end of file
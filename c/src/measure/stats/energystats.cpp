@@ -1,28 +1,300 @@
 #include "energystats.hpp"
 
+#include "../../logging.hpp"
+
+#if __linux__
+#include "../utils/procfs.hpp"
+#include "../utils/rangeutils.hpp"
+#include "../utils/sysfs.hpp"
+
+#include <algorithm>
+#include <cstdlib>
+#include <map>
+#endif
+
 using namespace std::string_literals;
+using std::chrono::steady_clock;
 
 using tirex::EnergyStats;
 using tirex::Stats;
 
 const char* EnergyStats::version = nullptr;
 const std::set<tirexMeasure> EnergyStats::measures{
-		TIREX_CPU_ENERGY_SYSTEM_JOULES, TIREX_RAM_ENERGY_SYSTEM_JOULES, TIREX_GPU_ENERGY_SYSTEM_JOULES
-};
+		TIREX_CPU_ENERGY_SYSTEM_JOULES, TIREX_RAM_ENERGY_SYSTEM_JOULES, TIREX_ENERGY_DOMAINS_JOULES,
+		TIREX_POWER_DOMAINS_WATTS, TIREX_CPU_ENERGY_PROCESS_JOULES, TIREX_RAM_ENERGY_PROCESS_JOULES,
+		TIREX_CPU_ENERGY_ESTIMATED_JOULES, TIREX_CPU_POWER_ESTIMATED_WATTS, TIREX_CPU_POWER_MODEL
+}; // The energy of the GPUs is reported by GPUStats
+
+#if __linux__
+namespace procfs = tirex::utils::procfs;
+namespace sysfs = tirex::utils::sysfs;
+
+/**
+ * @brief Lists the zones of the given powercap control type (e.g., `intel-rapl`), whose directories are named like
+ * `intel-rapl:0` for top-level zones and `intel-rapl:0:1` for their subzones, ordered by name.
+ */
+static std::vector<std::filesystem::path> listZones(const std::string& type) {
+	std::vector<std::filesystem::path> zones;
+	std::error_code ec;
+	auto dir = sysfs::root() / "class" / "powercap";
+	for (std::filesystem::directory_iterator it(dir, ec), end; !ec && it != end; it.increment(ec)) {
+		if (it->path().filename().string().starts_with(type + ":"))
+			zones.emplace_back(it->path());
+	}
+	std::ranges::sort(zones);
+	return zones;
+}
+
+EnergyStats::DomainKind EnergyStats::toKind(const std::string& name) {
+	static const std::map<std::string, DomainKind> kinds{
+			{"package", DomainKind::Package},
+			{"core", DomainKind::Core},
+			{"uncore", DomainKind::Uncore},
+			{"dram", DomainKind::Dram},
+			{"psys", DomainKind::Psys}
+	};
+	auto it = kinds.find(name.substr(0, name.find('-'))); // Packages are called package-<N>
+	return (it != kinds.end()) ? it->second : DomainKind::Other;
+}
+
+EnergyStats::EnergyStats(const TrackingConf& conf)
+		: pids(procfs::toPids(conf.pids)),
+		  estimate(conf.requested(
+				  {TIREX_CPU_ENERGY_ESTIMATED_JOULES, TIREX_CPU_POWER_ESTIMATED_WATTS, TIREX_CPU_POWER_MODEL}
+		  )),
+		  attribute(conf.requested({TIREX_CPU_ENERGY_PROCESS_JOULES, TIREX_RAM_ENERGY_PROCESS_JOULES})) {
+	// https://docs.kernel.org/power/powercap/powercap.html; the MMIO interface exposes the same package counters, so we
+	// only use it if the MSR interface is not available.
+	auto zones = listZones("intel-rapl");
+	if (zones.empty())
+		zones = listZones("intel-rapl-mmio");
+	// The long-term power limit (PL1) of a package usually corresponds to its TDP and, unlike the energy counters, is
+	// readable by everyone
+	double limitWatts = 0;
+	std::vector<std::string> unreadable;
+	for (const auto& zone : zones) {
+		auto name = sysfs::readString(zone / "name");
+		if (!name)
+			continue;
+		auto label = *name;
+		auto dirName = zone.filename().string();
+		if (auto pos = dirName.rfind(':'); dirName.find(':') != pos) {
+			// Subzones (core, uncore, dram) are named without the package they belong to
+			auto parentName = sysfs::readString(zone.parent_path() / dirName.substr(0, pos) / "name").value_or("");
+			if (auto dash = parentName.rfind('-'); dash != std::string::npos)
+				label += parentName.substr(dash);
+		}
+		auto kind = toKind(*name);
+		if (kind == DomainKind::Package)
+			limitWatts += sysfs::readUint(zone / "constraint_0_power_limit_uw").value_or(0) / 1e6;
+		// Domains whose counter cannot be read would only report 0, so they are left out
+		if (!sysfs::readUint(zone / "energy_uj")) {
+			unreadable.emplace_back(label);
+			continue;
+		}
+		domains.emplace_back(Domain{
+				.label = label,
+				.kind = kind,
+				.counter = zone / "energy_uj",
+				.maxRangeUj = sysfs::readUint(zone / "max_energy_range_uj").value_or(0)
+		});
+		power.column(label);
+	}
+	if (!unreadable.empty()) {
+		tirex::log::warn(
+				"energystats", "Could not read the energy counters of [{}], they are usually only readable by root",
+				tirex::utils::join(unreadable, ',')
+		);
+	}
+	if (domains.empty()) {
+		tirex::log::warn(
+				"energystats", "Found no readable RAPL domains in {}, only the estimated energy is available",
+				(sysfs::root() / "class" / "powercap").string()
+		);
+	}
+	if (!estimate)
+		return;
+	for (const auto& cpu : sysfs::listNumbered(sysfs::root() / "devices" / "system" / "cpu", "cpu"))
+		cpufreqDirs.emplace_back(cpu / "cpufreq");
+	model = detectPowerModel(limitWatts);
+	tirex::log::info(
+			"energystats", "Estimating the CPU power from {:.1f} W (idle) to {:.1f} W (max) [{}]", model.idleWatts,
+			model.maxWatts, model.source
+	);
+}
+
+static std::optional<double> readWattsEnv(const char* name) {
+	auto env = std::getenv(name);
+	if (env == nullptr || *env == '\0')
+		return std::nullopt;
+	return std::strtod(env, nullptr);
+}
 
-EnergyStats::EnergyStats() : tracker() {}
+EnergyStats::PowerModel EnergyStats::detectPowerModel(double limitWatts) const {
+	// Without further information, idle CPUs are assumed to draw 30% of their maximum power
+	constexpr double idleRatio = 0.3;
+	auto maxWatts = readWattsEnv("TIREX_POWER_MODEL_MAX_WATTS");
+	if (maxWatts) {
+		auto idleWatts = readWattsEnv("TIREX_POWER_MODEL_IDLE_WATTS").value_or(*maxWatts * idleRatio);
+		return {.idleWatts = idleWatts, .maxWatts = *maxWatts, .source = "config"};
+	}
+	if (limitWatts > 0)
+		return {.idleWatts = limitWatts * idleRatio, .maxWatts = limitWatts, .source = "rapl"};
+	// Roughly what a logical CPU of a current server processor is budgeted (e.g., 64 threads at 320 W)
+	constexpr double wattsPerCpu = 5;
+	auto cpus = static_cast<double>(std::max<size_t>(cpufreqDirs.size(), 1));
+	return {.idleWatts = cpus * wattsPerCpu * idleRatio, .maxWatts = cpus * wattsPerCpu, .source = "default"};
+}
+
+double EnergyStats::estimatePower() {
+	auto cores = procfs::readCoreCpuTimes();
+	double load = 0;
+	for (size_t i = 0; i < cores.size(); ++i) {
+		auto last = (i < lastCoreTimes.size()) ? lastCoreTimes[i] : procfs::CpuTimes{};
+		auto busy = (cores[i].busy > last.busy) ? cores[i].busy - last.busy : 0;
+		auto idle = (cores[i].idle > last.idle) ? cores[i].idle - last.idle : 0;
+		if (busy + idle == 0)
+			continue;
+		// Frequency scaling reduces the dynamic power, so a CPU is weighted by its current relative frequency if known
+		double frequency = 1;
+		if (i < cpufreqDirs.size()) {
+			auto cur = sysfs::readUint(cpufreqDirs[i] / "scaling_cur_freq");
+			auto max = sysfs::readUint(cpufreqDirs[i] / "cpuinfo_max_freq");
+			if (cur && max && *max != 0)
+				frequency = std::min(1.0, static_cast<double>(*cur) / static_cast<double>(*max));
+		}
+		load += static_cast<double>(busy) / static_cast<double>(busy + idle) * frequency;
+	}
+	lastCoreTimes = std::move(cores);
+	auto numCpus = static_cast<double>(std::max<size_t>(lastCoreTimes.size(), 1));
+	return model.idleWatts + (model.maxWatts - model.idleWatts) * load / numCpus;
+}
+
+static uint64_t readBusyTicks() {
+	auto times = procfs::readCpuTimes();
+	return times ? times->busy : 0;
+}
+
+uint64_t EnergyStats::readProcessTicks() const {
+	uint64_t ticks = 0;
+	for (auto process : procfs::listProcessTree(pids)) {
+		if (auto stat = procfs::readStat(process); stat)
+			ticks += stat->utime + stat->stime + stat->cutime + stat->cstime;
+	}
+	return ticks;
+}
+
+void EnergyStats::update(std::vector<unsigned>* row) {
+	auto now = steady_clock::now();
+	auto elapsedUs = std::chrono::duration_cast<std::chrono::microseconds>(now - lastUpdate).count();
+	lastUpdate = now;
+	// The share of the CPU time that was spent by the tracked processes since the last update. The process time may
+	// decrease if a child is orphaned and leaves the tree, and jiffies are coarse, so the share is clamped to [0, 1].
+	double share = 0;
+	if (attribute) {
+		auto busyTicks = readBusyTicks();
+		auto processTicks = readProcessTicks();
+		if (busyTicks > lastBusyTicks && processTicks > lastProcessTicks) {
+			auto ticks = static_cast<double>(processTicks - lastProcessTicks);
+			share = std::min(1.0, ticks / static_cast<double>(busyTicks - lastBusyTicks));
+		}
+		lastBusyTicks = busyTicks;
+		lastProcessTicks = processTicks;
+	}
+	if (estimate) {
+		auto watts = estimatePower();
+		estimatedUj += watts * static_cast<double>(elapsedUs);
+		if (row != nullptr)
+			estimatedPower.addValue(static_cast<unsigned>(watts + 0.5));
+	}
+	for (size_t i = 0; i < domains.size(); ++i) {
+		auto& domain = domains[i];
+		auto energy = sysfs::readUint(domain.counter);
+		if (!energy)
+			continue;
+		// The counter wraps around to 0 after max_energy_range_uj, which may happen within minutes under load
+		uint64_t deltaUj = *energy - domain.lastUj;
+		if (*energy < domain.lastUj)
+			deltaUj = (domain.maxRangeUj > domain.lastUj) ? (domain.maxRangeUj - domain.lastUj + *energy) : *energy;
+		domain.lastUj = *energy;
+		domain.totalUj += deltaUj;
+		if (domain.kind == DomainKind::Package)
+			attributedPackageUj += static_cast<double>(deltaUj) * share;
+		else if (domain.kind == DomainKind::Dram)
+			attributedDramUj += static_cast<double>(deltaUj) * share;
+		if (row != nullptr && elapsedUs > 0)
+			(*row)[i] = static_cast<unsigned>((deltaUj + elapsedUs / 2) / elapsedUs);
+	}
+}
+
+double EnergyStats::sumJoules(DomainKind kind) const {
+	uint64_t totalUj = 0;
+	for (const auto& domain : domains) {
+		if (domain.kind == kind)
+			totalUj += domain.totalUj;
+	}
+	return static_cast<double>(totalUj) / 1e6;
+}
+
+void EnergyStats::start() {
+	lastUpdate = steady_clock::now();
+	if (attribute) {
+		lastBusyTicks = readBusyTicks();
+		lastProcessTicks = readProcessTicks();
+	}
+	if (estimate)
+		lastCoreTimes = procfs::readCoreCpuTimes();
+	attributedPackageUj = attributedDramUj = estimatedUj = 0;
+	for (auto& domain : domains) {
+		domain.lastUj = sysfs::readUint(domain.counter).value_or(0);
+		domain.totalUj = 0;
+	}
+}
+void EnergyStats::stop() { update(nullptr); }
+void EnergyStats::step() {
+	std::vector<unsigned> row(domains.size());
+	update(&row);
+	power.addRow(std::move(row));
+}
+
+Stats EnergyStats::getStats() {
+	Stats stats;
+	if (estimate) {
+		stats.insert({TIREX_CPU_ENERGY_ESTIMATED_JOULES, _fmt::format("{:.3f}", estimatedUj / 1e6)});
+		stats.insert({TIREX_CPU_POWER_ESTIMATED_WATTS, estimatedPower});
+		auto powerModel = _fmt::format(
+				"{{idle_watts: {:.1f}, max_watts: {:.1f}, source: {}}}", model.idleWatts, model.maxWatts, model.source
+		);
+		stats.insert({TIREX_CPU_POWER_MODEL, powerModel});
+	}
+	if (domains.empty())
+		return stats;
+	std::vector<std::string> joules;
+	for (const auto& domain : domains)
+		joules.emplace_back(_fmt::format("{}: {:.3f}", domain.label, domain.totalUj / 1e6));
+	stats.insert({TIREX_CPU_ENERGY_SYSTEM_JOULES, _fmt::format("{:.3f}", sumJoules(DomainKind::Package))});
+	stats.insert({TIREX_CPU_ENERGY_PROCESS_JOULES, _fmt::format("{:.3f}", attributedPackageUj / 1e6)});
+	stats.insert({TIREX_ENERGY_DOMAINS_JOULES, "{" + tirex::utils::join(joules, ',') + "}"});
+	stats.insert({TIREX_POWER_DOMAINS_WATTS, power});
+	if (std::ranges::any_of(domains, [](const Domain& domain) { return domain.kind == DomainKind::Dram; })) {
+		stats.insert({TIREX_RAM_ENERGY_SYSTEM_JOULES, _fmt::format("{:.3f}", sumJoules(DomainKind::Dram))});
+		stats.insert({TIREX_RAM_ENERGY_PROCESS_JOULES, _fmt::format("{:.3f}", attributedDramUj / 1e6)});
+	}
+	return stats;
+}
+#else
+EnergyStats::EnergyStats(const TrackingConf&) : tracker() {}
 
 void EnergyStats::start() { tracker.start(); }
 void EnergyStats::stop() { tracker.stop(); }
+void EnergyStats::step() {}
 Stats EnergyStats::getStats() {
-	/** \todo: filter by requested metrics */
 	/*auto results = tracker.calculate_energy().energy;
 	Stats stats{};
 	for (auto& [device, result] : results)
 		stats.insertChild(device, {std::to_string(result)});
 
 	return {{"energy", stats}};*/
-	return {{TIREX_CPU_ENERGY_SYSTEM_JOULES, "TODO"s},
-			{TIREX_RAM_ENERGY_SYSTEM_JOULES, "TODO"s},
-			{TIREX_GPU_ENERGY_SYSTEM_JOULES, "TODO"s}};
-}
\ No newline at end of file
+	return {{TIREX_CPU_ENERGY_SYSTEM_JOULES, "TODO"s}, {TIREX_RAM_ENERGY_SYSTEM_JOULES, "TODO"s}};
+}
+#endif
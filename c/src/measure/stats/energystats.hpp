@@ -1,9 +1,20 @@
 #ifndef STATS_ENERGYSTATS_HPP
 #define STATS_ENERGYSTATS_HPP
 
+#include "../measure.hpp"
 #include "provider.hpp"
 
-#ifndef __APPLE__
+#if __linux__
+#include "../utils/procfs.hpp"
+
+#include <chrono>
+#include <cstdint>
+#include <filesystem>
+#include <string>
+#include <vector>
+
+#include <sys/types.h>
+#elif !defined(__APPLE__)
 #include <cppJoules.hpp>
 #else
 class EnergyTracker {
@@ -14,15 +25,90 @@ public:
 #endif
 
 namespace tirex {
+	/**
+	 * @brief Collects the energy consumption of various components.
+	 * @details On Linux, the energy counters of the RAPL domains (package, core, uncore, dram and psys) are read from
+	 * `/sys/class/powercap/intel-rapl:*`, which is also used for AMD CPUs. Reading them requires root privileges on
+	 * most distributions, and domains whose counter cannot be read are left out (as are the RAPL measures if none is
+	 * readable). The sysfs root can be overridden by setting `TIREX_SYSFS_ROOT`.
+	 * Since the package and DRAM counters cover all processes on the machine, their energy is additionally attributed
+	 * to the tracked processes: at every step, the energy consumed since the previous step is split by the share that
+	 * the tracked process trees had in the CPU time all processes spent during the same interval.
+	 *
+	 * Independently of RAPL (e.g., in virtual machines, where no counters are available), the energy of the CPUs is
+	 * estimated from a linear power model: at every step, each logical CPU contributes its utilization times its
+	 * current relative frequency to the dynamic power between the idle and the maximum power. The parameters are
+	 * configured using `TIREX_POWER_MODEL_IDLE_WATTS` and `TIREX_POWER_MODEL_MAX_WATTS` or derived from the RAPL power
+	 * limit of the packages (falling back to a rough per-CPU default), such that the estimate can be calibrated on
+	 * machines that provide RAPL.
+	 */
 	class EnergyStats final : public StatsProvider {
 	private:
+#if __linux__
+		enum class DomainKind { Package, Core, Uncore, Dram, Psys, Other };
+		struct Domain {
+			std::string label; /**< The name of the domain with the package it belongs to (e.g., dram-0) **/
+			DomainKind kind;
+			std::filesystem::path counter; /**< The `energy_uj` file **/
+			uint64_t maxRangeUj; /**< The value after which the counter wraps around to 0 (`max_energy_range_uj`) **/
+			uint64_t lastUj = 0;
+			uint64_t totalUj = 0; /**< The energy consumed since tracking started **/
+		};
+
+		struct PowerModel {
+			double idleWatts;	/**< The power drawn by all CPUs when they are idle **/
+			double maxWatts;	/**< The power drawn when all CPUs are fully utilized at their maximum frequency **/
+			const char* source; /**< Where the parameters came from (config, rapl or default) **/
+		};
+
+		std::vector<Domain> domains;
+		std::vector<pid_t> pids;
+		const bool estimate;  /**< Whether any of the estimated measures (or the power model) was requested **/
+		const bool attribute; /**< Whether any of the energies attributed to the tracked processes was requested **/
+		PowerModel model{};
+		std::vector<std::filesystem::path> cpufreqDirs; /**< The `cpufreq` directory of each logical CPU **/
+		std::vector<tirex::utils::procfs::CpuTimes> lastCoreTimes;
+		double estimatedUj = 0;
+		tirex::TimeSeries<unsigned> estimatedPower{true};
+		std::chrono::steady_clock::time_point lastUpdate;
+		uint64_t lastBusyTicks = 0;	   /**< The time all CPUs were busy at the last update (in clock ticks) **/
+		uint64_t lastProcessTicks = 0; /**< The CPU time of the tracked process trees at the last update **/
+		double attributedPackageUj = 0;
+		double attributedDramUj = 0;
+		tirex::TimeSeriesMatrix<unsigned> power; /**< The average power of each domain since the last step in watts **/
+
+		/**
+		 * @brief Reads the counters of all domains and adds the energy consumed since the last call to their total.
+		 * @param row If not null, the average power since the last call is written to it (one value per domain).
+		 */
+		void update(std::vector<unsigned>* row);
+		/**
+		 * @brief Returns the CPU time (in clock ticks) spent by the tracked process trees, including the children that
+		 * exited and were waited for.
+		 */
+		uint64_t readProcessTicks() const;
+		/**
+		 * @brief Estimates the average power (in watts) drawn by the CPUs since the last call using the power model.
+		 */
+		double estimatePower();
+		/**
+		 * @brief Returns the parameters of the power model.
+		 * @param limitWatts The sum of the long-term power limits of the RAPL packages or 0 if there are none.
+		 */
+		PowerModel detectPowerModel(double limitWatts) const;
+		/** @brief Returns the energy (in joules) consumed by all domains of the given kind since tracking started. */
+		double sumJoules(DomainKind kind) const;
+		static DomainKind toKind(const std::string& name);
+#else
 		EnergyTracker tracker;
+#endif
 
 	public:
-		EnergyStats();
+		explicit EnergyStats(const TrackingConf& conf);
 
 		void start() override;
 		void stop() override;
+		void step() override;
 		Stats getStats() override;
 
 		static constexpr const char* description = "Collects the energy consumption of various components.";
@@ -31,4 +117,4 @@ namespace tirex {
 	};
 } // namespace tirex
 
-#endif
\ No newline at end of file
+#endif
@@ -4,13 +4,38 @@
 #include "../utils/rangeutils.hpp"
 
 #include <git2.h>
-#include <sha1.h>
+#define XXH_INLINE_ALL
+#include <xxhash.h>
 
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <charconv>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
 #include <filesystem>
 #include <fstream>
+#include <map>
+#include <optional>
 #include <ranges>
+#include <sstream>
 #include <string>
+#include <string_view>
+#include <thread>
 #include <tuple>
+#include <utility>
+#include <vector>
+
+#if !defined(_WIN64)
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+#if __linux__
+#include <sys/resource.h>
+#include <sys/syscall.h>
+#endif
 
 using namespace std::string_literals;
 
@@ -22,7 +47,17 @@ const std::set<tirexMeasure> GitStats::measures{TIREX_GIT_IS_REPO,			TIREX_GIT_H
 												TIREX_GIT_LAST_COMMIT_HASH, TIREX_GIT_BRANCH,
 												TIREX_GIT_BRANCH_UPSTREAM,	TIREX_GIT_TAGS,
 												TIREX_GIT_REMOTE_ORIGIN,	TIREX_GIT_UNCOMMITTED_CHANGES,
-												TIREX_GIT_UNPUSHED_CHANGES, TIREX_GIT_UNCHECKED_FILES};
+												TIREX_GIT_UNPUSHED_CHANGES, TIREX_GIT_UNCHECKED_FILES,
+/** \todo: check the index and the hashed files on Windows (statFile is not supported) */
+#if !defined(_WIN64)
+												TIREX_GIT_CHANGED_DURING_RUN
+#endif
+};
+
+static uint64_t nowNs() {
+	auto now = std::chrono::system_clock::now().time_since_epoch();
+	return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(now).count());
+}
 
 static std::string getLastCommitHash(git_repository* repo) {
 	git_oid id;
@@ -118,26 +153,230 @@ static std::vector<std::string> getTags(git_repository* repo) {
 	return tagNames;
 }
 
-static std::string hashAllFiles(git_repository* repo) {
-	Chocobo1::SHA1 hash;
-	git_status_list* list;
-	git_status_options opts = GIT_STATUS_OPTIONS_INIT;
-	opts.flags = GIT_STATUS_OPT_INCLUDE_UNTRACKED | GIT_STATUS_OPT_INCLUDE_UNMODIFIED;
-	git_status_list_new(&list, repo, &opts);
-	auto changes = git_status_list_entrycount(list);
+/**
+ * @brief Hashes the contents of the file with XXH3.
+ * @details The file is read in large chunks rather than memory mapped since the files may change while they are
+ * hashed in the background and accessing a mapping beyond the end of a truncated file raises SIGBUS.
+ * @return the hash or std::nullopt if the file could not be read.
+ */
+static std::optional<XXH128_hash_t> hashFile(const std::filesystem::path& path) {
+	thread_local std::vector<char> buffer(1 << 20);
+	auto state = XXH3_createState();
+	XXH3_128bits_reset(state);
+#if !defined(_WIN64)
+	int fd = open(path.c_str(), O_RDONLY | O_CLOEXEC);
+	if (fd < 0) {
+		XXH3_freeState(state);
+		return std::nullopt;
+	}
+#if __linux__
+	posix_fadvise(fd, 0, 0, POSIX_FADV_SEQUENTIAL);
+#endif
+	ssize_t num;
+	while ((num = read(fd, buffer.data(), buffer.size())) != 0) {
+		if (num < 0 && errno == EINTR)
+			continue;
+		if (num < 0) {
+			close(fd);
+			XXH3_freeState(state);
+			return std::nullopt;
+		}
+		XXH3_128bits_update(state, buffer.data(), static_cast<size_t>(num));
+	}
+	close(fd);
+#else
+	std::ifstream is(path, std::ios::binary);
+	if (!is) {
+		XXH3_freeState(state);
+		return std::nullopt;
+	}
+	while (is.read(buffer.data(), static_cast<std::streamsize>(buffer.size())) || is.gcount() > 0)
+		XXH3_128bits_update(state, buffer.data(), static_cast<size_t>(is.gcount()));
+#endif
+	auto hash = XXH3_128bits_digest(state);
+	XXH3_freeState(state);
+	return hash;
+}
+
+/**
+ * @brief The stat information of a file that, like the stat cache in git's index, tells whether the file changed since
+ * it was last hashed.
+ */
+struct FileKey {
+	uint64_t size;
+	uint64_t mtimeNs;
+	uint64_t ctimeNs;
+	uint64_t inode;
+
+	bool operator==(const FileKey&) const = default;
+};
+
+/**
+ * @brief Returns the stat information of the file or std::nullopt if it is not a regular file (or the platform is not
+ * supported), in which case it is always hashed.
+ */
+static std::optional<FileKey> statFile(const std::filesystem::path& path) {
+#if defined(_WIN64)
+	/** \todo: support the cache on Windows (the file index is not provided by std::filesystem) */
+	return std::nullopt;
+#else
+	struct stat st;
+	if (stat(path.c_str(), &st) != 0 || !S_ISREG(st.st_mode))
+		return std::nullopt;
+	auto toNs = [](const timespec& ts) {
+		return static_cast<uint64_t>(ts.tv_sec) * 1000000000 + static_cast<uint64_t>(ts.tv_nsec);
+	};
+#if defined(__APPLE__)
+	return FileKey{static_cast<uint64_t>(st.st_size), toNs(st.st_mtimespec), toNs(st.st_ctimespec), st.st_ino};
+#else
+	return FileKey{static_cast<uint64_t>(st.st_size), toNs(st.st_mtim), toNs(st.st_ctim), st.st_ino};
+#endif
+#endif
+}
+
+static std::string toHex(const XXH128_hash_t& hash) { return _fmt::format("{:016x}{:016x}", hash.high64, hash.low64); }
+
+using HashCache = std::map<std::string, std::pair<FileKey, XXH128_hash_t>>;
+static constexpr const char* hashCacheHeader = "tirex-hash-cache v1";
+
+/**
+ * @brief Loads the hashes of the files that were computed by previous runs.
+ * @details The cache is a text file with a header line followed by one line per file:
+ * `<hash> <size> <mtime> <ctime> <inode> <path>`. If it does not exist or is malformed, the cache is empty.
+ */
+static HashCache loadHashCache(const std::filesystem::path& file) {
+	HashCache cache;
+	std::ifstream is(file);
+	std::string line;
+	if (!std::getline(is, line) || line != hashCacheHeader)
+		return cache;
+	while (std::getline(is, line)) {
+		std::istringstream ls(line);
+		std::string hex;
+		FileKey key;
+		if (!(ls >> hex >> key.size >> key.mtimeNs >> key.ctimeNs >> key.inode) || hex.size() != 32 || ls.get() != ' ')
+			return {};
+		XXH128_hash_t hash;
+		auto high = std::from_chars(hex.data(), hex.data() + 16, hash.high64, 16);
+		auto low = std::from_chars(hex.data() + 16, hex.data() + 32, hash.low64, 16);
+		if (high.ec != std::errc{} || low.ec != std::errc{})
+			return {};
+		std::string path;
+		std::getline(ls, path);
+		cache.insert_or_assign(std::move(path), std::pair{key, hash});
+	}
+	return cache;
+}
+
+/**
+ * @brief Replaces the cache on disk. The new cache is written to a temporary file first, such that concurrent runs
+ * never read a partially written cache.
+ */
+static void storeHashCache(const std::filesystem::path& file, const HashCache& cache) {
+	auto tmp = file;
+	tmp += _fmt::format(".{}.tmp", std::chrono::steady_clock::now().time_since_epoch().count());
+	{
+		std::ofstream os(tmp);
+		os << hashCacheHeader << '\n';
+		for (const auto& [path, entry] : cache) {
+			const auto& [key, hash] = entry;
+			os << toHex(hash) << ' ' << key.size << ' ' << key.mtimeNs << ' ' << key.ctimeNs << ' ' << key.inode << ' '
+			   << path << '\n';
+		}
+		if (!os) {
+			tirex::log::warn("gitstats", "Failed to write the hash cache {}", tmp.string());
+			std::error_code ec;
+			std::filesystem::remove(tmp, ec);
+			return;
+		}
+	}
+	std::error_code ec;
+	std::filesystem::rename(tmp, file, ec);
+	if (ec) {
+		tirex::log::warn("gitstats", "Failed to replace the hash cache {}: {}", file.string(), ec.message());
+		std::filesystem::remove(tmp, ec);
+	}
+}
+
+/**
+ * @brief Returns where the hashes of the files are cached: `TIREX_GIT_HASH_CACHE` if it is set (an empty value
+ * disables the cache) and `tirex-hash-cache` in the repository's git directory otherwise.
+ */
+static std::optional<std::filesystem::path> hashCachePath(git_repository* repo) {
+	if (auto env = std::getenv("TIREX_GIT_HASH_CACHE"); env != nullptr)
+		return (*env != '\0') ? std::optional<std::filesystem::path>(env) : std::nullopt;
+	return std::filesystem::path(git_repository_path(repo)) / "tirex-hash-cache";
+}
+
+/**
+ * @brief Computes a hash over the paths and contents of the given files of the working tree.
+ * @details The files are hashed in parallel and the hash of each file is then combined with its path in the order of
+ * the paths, such that the result does not depend on the number of threads. The number of threads defaults to the
+ * number of logical CPUs and can be set using `TIREX_GIT_HASH_THREADS`.
+ *
+ * Files whose size, modification and change time and inode did not change since a previous run are not hashed again
+ * but their hash is taken from the cache (see hashCachePath).
+ */
+static std::string hashFiles(git_repository* repo, std::vector<std::string> paths) {
+	std::ranges::sort(paths);
+
 	std::filesystem::path root = git_repository_workdir(repo);
-	for (size_t i = 0; i < changes; ++i) {
-		auto entry = git_status_byindex(list, i);
-		std::ifstream is(root / entry->index_to_workdir->new_file.path, std::ios::binary);
-		if (!is) {
-			tirex::log::error("gitstats", "Error opening file: {}", entry->index_to_workdir->new_file.path);
+	auto cachePath = hashCachePath(repo);
+	const auto cache = cachePath ? loadHashCache(*cachePath) : HashCache{};
+	std::vector<std::optional<XXH128_hash_t>> hashes(paths.size());
+	std::vector<std::optional<FileKey>> keys(paths.size());
+	std::atomic<size_t> next = 0;
+	std::atomic<size_t> numHashed = 0;
+	auto worker = [&]() {
+		for (size_t i; (i = next++) < paths.size();) {
+			keys[i] = statFile(root / paths[i]);
+			if (auto it = cache.find(paths[i]); keys[i] && it != cache.end() && it->second.first == *keys[i]) {
+				hashes[i] = it->second.second;
+			} else {
+				hashes[i] = hashFile(root / paths[i]);
+				++numHashed;
+			}
+		}
+	};
+	auto startNs = nowNs();
+	size_t numThreads = std::max(std::thread::hardware_concurrency(), 1u);
+	if (auto env = std::getenv("TIREX_GIT_HASH_THREADS"); env != nullptr && std::strtoul(env, nullptr, 10) != 0)
+		numThreads = std::strtoul(env, nullptr, 10);
+	numThreads = std::min(numThreads, paths.size());
+	{
+		std::vector<std::jthread> workers;
+		for (size_t i = 1; i < numThreads; ++i)
+			workers.emplace_back(worker);
+		worker();
+	}
+	tirex::log::debug("gitstats", "Hashed {} of {} files, the rest was cached", numHashed.load(), paths.size());
+	if (cachePath && (numHashed != 0 || cache.size() != paths.size())) {
+		HashCache updated;
+		for (size_t i = 0; i < paths.size(); ++i) {
+			// Like git, we do not trust the stat information of files that were modified just now, since they may be
+			// modified again within the granularity of the timestamps without the stat information changing
+			bool racy = keys[i] && keys[i]->mtimeNs + 2000000000 >= startNs;
+			if (hashes[i] && keys[i] && !racy && paths[i].find('\n') == std::string::npos)
+				updated.emplace(paths[i], std::pair{*keys[i], *hashes[i]});
+		}
+		storeHashCache(*cachePath, updated);
+	}
+
+	auto state = XXH3_createState();
+	XXH3_128bits_reset(state);
+	for (size_t i = 0; i < paths.size(); ++i) {
+		if (!hashes[i]) {
+			tirex::log::error("gitstats", "Error opening file: {}", paths[i]);
 			continue;
 		}
-		for (char buffer[8192]; is; is.read(buffer, sizeof(buffer)))
-			hash.addData(buffer, is.gcount());
+		XXH3_128bits_update(state, paths[i].c_str(), paths[i].size() + 1); // Including the terminating null
+		XXH128_canonical_t canonical;
+		XXH128_canonicalFromHash(&canonical, *hashes[i]);
+		XXH3_128bits_update(state, canonical.digest, sizeof(canonical.digest));
 	}
-	git_status_list_free(list);
-	return hash.finalize().toString();
+	auto result = XXH3_128bits_digest(state);
+	XXH3_freeState(state);
+	return toHex(result);
 }
 
 struct GitStatusStats {
@@ -145,76 +384,241 @@ struct GitStatusStats {
 	size_t numModified;
 	/** The number of files that were not yet added to the repository **/
 	size_t numNew;
-	/** The number of commits ahead of remote origin **/
-	size_t ahead;
-	/** The number of commits behind of remote origin **/
-	size_t behind;
+	/** The (tracked and untracked) files in the working tree whose contents make up TIREX_GIT_HASH **/
+	std::vector<std::string> files;
 };
 
-static GitStatusStats getStatusStats(git_repository* repo) {
-	GitStatusStats stats = {.numModified = 0, .numNew = 0, .ahead = 0, .behind = 0};
+/**
+ * @brief Collects the status of the working tree and the files to hash with a single walk.
+ * @details The cost of the walk can be bounded on huge repositories: `TIREX_GIT_UNTRACKED_FILES` controls how
+ * untracked files are scanned like git's `status.showUntrackedFiles` (`all` lists the files in untracked directories,
+ * `normal` only the directories, which are then not hashed, and `no` skips untracked files) and `TIREX_GIT_IGNORE_DIRS`
+ * is a colon-separated list of directories (relative to the root of the working tree) that are skipped entirely.
+ * @param refreshIndex If false, the index that the repository already loaded is used even if it changed on disk.
+ */
+static GitStatusStats getStatusStats(git_repository* repo, bool refreshIndex) {
+	GitStatusStats stats = {.numModified = 0, .numNew = 0, .files = {}};
 	{
+		git_status_options opts = GIT_STATUS_OPTIONS_INIT;
+		opts.flags = GIT_STATUS_OPT_INCLUDE_UNMODIFIED;
+		if (!refreshIndex)
+			opts.flags |= GIT_STATUS_OPT_NO_REFRESH;
+		auto env = std::getenv("TIREX_GIT_UNTRACKED_FILES");
+		std::string untracked = (env != nullptr) ? env : "all";
+		if (untracked == "normal") {
+			opts.flags |= GIT_STATUS_OPT_INCLUDE_UNTRACKED;
+		} else if (untracked != "no") {
+			if (untracked != "all")
+				tirex::log::warn("gitstats", "Unknown value {} for TIREX_GIT_UNTRACKED_FILES, using all", untracked);
+			opts.flags |= GIT_STATUS_OPT_INCLUDE_UNTRACKED | GIT_STATUS_OPT_RECURSE_UNTRACKED_DIRS;
+		}
+		std::vector<std::string> ignoredDirs;
+		if (auto env = std::getenv("TIREX_GIT_IGNORE_DIRS"); env != nullptr) {
+			std::istringstream is(env);
+			for (std::string dir; std::getline(is, dir, ':');) {
+				while (dir.ends_with('/'))
+					dir.pop_back();
+				if (!dir.empty())
+					ignoredDirs.emplace_back(dir + "/");
+			}
+		}
+		// As ignore rules, libgit2 does not even descend into the directories if they are untracked. Tracked files
+		// within them are still reported by the walk and skipped below.
+		git_ignore_clear_internal_rules(repo);
+		for (const auto& dir : ignoredDirs) {
+			if (int err; err = git_ignore_add_rule(repo, ("/" + dir).c_str()))
+				tirex::log::warn("gitstats", "Failed to ignore {}: {}", dir, git_error_last()->message);
+		}
+
 		git_status_list* list;
-		git_status_list_new(&list, repo, nullptr);
-		auto changes = git_status_list_entrycount(list);
-		for (size_t i = 0; i < changes; ++i) {
+		if (int err; err = git_status_list_new(&list, repo, &opts)) {
+			tirex::log::error("gitstats", "Failed to fetch the status: {}", git_error_last()->message);
+			return stats;
+		}
+		for (size_t i = 0; i < git_status_list_entrycount(list); ++i) {
 			auto entry = git_status_byindex(list, i);
+			auto delta = (entry->index_to_workdir != nullptr) ? entry->index_to_workdir : entry->head_to_index;
+			std::string_view path = delta->new_file.path;
+			if (std::ranges::any_of(ignoredDirs, [path](const auto& dir) { return path.starts_with(dir); }))
+				continue;
 			if (entry->status & (git_status_t::GIT_STATUS_INDEX_NEW | GIT_STATUS_WT_NEW))
 				++stats.numNew;
 			else if (entry->status & (git_status_t::GIT_STATUS_INDEX_MODIFIED | git_status_t::GIT_STATUS_WT_MODIFIED))
 				++stats.numModified;
+			// Untracked directories (with TIREX_GIT_UNTRACKED_FILES=normal) end with a slash
+			if (entry->index_to_workdir != nullptr && !(entry->status & GIT_STATUS_WT_DELETED) && !path.ends_with('/'))
+				stats.files.emplace_back(path);
 		}
 		git_status_list_free(list);
 	}
-	// Ahead / Behind
-	{
-		git_reference* upstream;
-		git_reference* head;
-		if (int err; err = git_repository_head(&head, repo)) {
-			tirex::log::error("gitstats", "Failed to fetch repository head: {}", git_error_last()->message);
-			return stats;
-		}
-		if (int err; err = git_branch_upstream(&upstream, head)) {
-			tirex::log::error("gitstats", "Failed to get upstream branch: {}", git_error_last()->message);
-			return stats;
-		}
-		auto local = git_reference_target(head);
-		auto remote = git_reference_target(upstream);
-		git_graph_ahead_behind(&stats.ahead, &stats.behind, repo, local, remote);
-	}
 	return stats;
 }
 
-GitStats::GitStats() : repo(nullptr) {
+/**
+ * @brief Counts the commits that the checked out branch is ahead and behind of its upstream branch, which does not
+ * need the status of the working tree.
+ * @return the number of commits ahead and behind or std::nullopt if they could not be counted.
+ */
+static std::optional<std::pair<size_t, size_t>> getAheadBehind(git_repository* repo) {
+	git_reference* head;
+	if (int err; err = git_repository_head(&head, repo)) {
+		tirex::log::error("gitstats", "Failed to fetch repository head: {}", git_error_last()->message);
+		return std::nullopt;
+	}
+	git_reference* upstream;
+	if (int err; err = git_branch_upstream(&upstream, head)) {
+		tirex::log::error("gitstats", "Failed to get upstream branch: {}", git_error_last()->message);
+		git_reference_free(head);
+		return std::nullopt;
+	}
+	size_t ahead = 0, behind = 0;
+	git_graph_ahead_behind(&ahead, &behind, repo, git_reference_target(head), git_reference_target(upstream));
+	git_reference_free(upstream);
+	git_reference_free(head);
+	return std::pair{ahead, behind};
+}
+
+/**
+ * @brief Lowers the scheduling and I/O priority of the calling thread (and the threads it spawns afterwards) to the
+ * lowest level, such that it competes as little as possible with the tracked program.
+ */
+static void lowerThreadPriority() {
+#if __linux__
+	// On Linux, the nice value and the I/O priority are per thread
+	auto tid = static_cast<id_t>(syscall(SYS_gettid));
+	if (setpriority(PRIO_PROCESS, tid, 19) != 0)
+		tirex::log::debug("gitstats", "Failed to lower the priority of the worker thread");
+	constexpr int ioprioWhoProcess = 1, ioprioClassIdle = 3, ioprioClassShift = 13;
+	if (syscall(SYS_ioprio_set, ioprioWhoProcess, tid, ioprioClassIdle << ioprioClassShift) != 0)
+		tirex::log::debug("gitstats", "Failed to lower the I/O priority of the worker thread");
+#else
+	/** \todo: lower the priority on other platforms */
+#endif
+}
+
+/**
+ * @brief Returns true if `TIREX_GIT_BACKGROUND` is set to a value other than `0`, i.e., if the git measures should be
+ * collected in the background while tracking.
+ */
+static bool backgroundEnabled() {
+	auto env = std::getenv("TIREX_GIT_BACKGROUND");
+	return env != nullptr && *env != '\0' && std::string_view(env) != "0";
+}
+
+GitStats::GitStats(const TrackingConf& conf) : repo(nullptr), conf(conf), background(backgroundEnabled()) {
 	git_libgit2_init();
 	if (int err; git_repository_open_ext(&repo, "./", 0, nullptr) < 0)
 		tirex::log::error("gitstats", "Failed to open git repository: {}", git_error_last()->message);
 }
-GitStats::~GitStats() { git_libgit2_shutdown(); }
+GitStats::~GitStats() {
+	if (async.worker.joinable())
+		async.worker.join();
+	git_libgit2_shutdown();
+}
 
 bool GitStats::isRepository() const noexcept { return repo != nullptr; }
 
-Stats GitStats::getInfo() {
-	/** \todo: filter by requested metrics */
-	if (isRepository()) {
-		auto status = getStatusStats(repo);
+Stats GitStats::collect(const std::string& head, bool refreshIndex, std::vector<std::string>* files) {
+	Stats stats{{TIREX_GIT_IS_REPO, "1"s}, {TIREX_GIT_LAST_COMMIT_HASH, head}};
+	if (conf.requested(
+				{TIREX_GIT_HASH, TIREX_GIT_UNCOMMITTED_CHANGES, TIREX_GIT_UNCHECKED_FILES, TIREX_GIT_CHANGED_DURING_RUN}
+		)) {
+		auto status = getStatusStats(repo, refreshIndex);
 		tirex::log::info(
 				"gitstats", "I counted {} tracked files that were changed and {} untracked files", status.numModified,
 				status.numNew
 		);
-		tirex::log::info("gitstats", "Local is {} commits ahead and {} behind upstream", status.ahead, status.behind);
+		stats.insert({{TIREX_GIT_UNCOMMITTED_CHANGES, (status.numModified != 0) ? "1"s : "0"s},
+					  {TIREX_GIT_UNCHECKED_FILES, (status.numNew != 0) ? "1"s : "0"s}});
+		if (conf.requested({TIREX_GIT_HASH}))
+			stats.insert({TIREX_GIT_HASH, hashFiles(repo, status.files)});
+		if (files != nullptr)
+			*files = std::move(status.files);
+	}
+	if (conf.requested({TIREX_GIT_BRANCH, TIREX_GIT_BRANCH_UPSTREAM, TIREX_GIT_UNPUSHED_CHANGES})) {
 		auto [local, remote] = getBranchName(repo);
-		return {{TIREX_GIT_IS_REPO, "1"s},
-				{TIREX_GIT_HASH, hashAllFiles(repo)},
-				{TIREX_GIT_LAST_COMMIT_HASH, getLastCommitHash(repo)},
-				{TIREX_GIT_BRANCH, local},
-				{TIREX_GIT_BRANCH_UPSTREAM, remote},
-				{TIREX_GIT_TAGS, "["s + tirex::utils::join(getTags(repo), ',') + "]"s},
-				{TIREX_GIT_REMOTE_ORIGIN, getRemoteOrigin(repo)},
-				{TIREX_GIT_UNCOMMITTED_CHANGES, (status.numModified != 0) ? "1"s : "0"s},
-				{TIREX_GIT_UNPUSHED_CHANGES, ((status.ahead != 0) || remote.empty()) ? "1"s : "0"s},
-				{TIREX_GIT_UNCHECKED_FILES, (status.numNew != 0) ? "1"s : "0"s}};
-	} else {
-		return {{TIREX_GIT_IS_REPO, "0"s}};
+		stats.insert({{TIREX_GIT_BRANCH, local}, {TIREX_GIT_BRANCH_UPSTREAM, remote}});
+		if (conf.requested({TIREX_GIT_UNPUSHED_CHANGES})) {
+			// Without an upstream branch, all commits are unpushed
+			size_t ahead = 0;
+			if (auto aheadBehind = remote.empty() ? std::nullopt : getAheadBehind(repo); aheadBehind) {
+				tirex::log::info(
+						"gitstats", "Local is {} commits ahead and {} behind upstream", aheadBehind->first,
+						aheadBehind->second
+				);
+				ahead = aheadBehind->first;
+			}
+			stats.insert({TIREX_GIT_UNPUSHED_CHANGES, ((ahead != 0) || remote.empty()) ? "1"s : "0"s});
+		}
+	}
+	if (conf.requested({TIREX_GIT_TAGS}))
+		stats.insert({TIREX_GIT_TAGS, "["s + tirex::utils::join(getTags(repo), ',') + "]"s});
+	if (conf.requested({TIREX_GIT_REMOTE_ORIGIN}))
+		stats.insert({TIREX_GIT_REMOTE_ORIGIN, getRemoteOrigin(repo)});
+	return stats;
+}
+
+#if !defined(_WIN64)
+bool GitStats::changedDuringRun() const {
+	if (getLastCommitHash(repo) != async.head)
+		return true;
+	// Timestamps of files are taken from a coarse clock that may lag behind by a few milliseconds
+	auto since = async.startNs - 10000000;
+	auto changed = [since](const std::optional<FileKey>& key) { return !key || key->ctimeNs >= since; };
+	if (auto index = statFile(std::filesystem::path(git_repository_path(repo)) / "index"); index && changed(index))
+		return true;
+	std::filesystem::path root = git_repository_workdir(repo);
+	return std::ranges::any_of(async.files, [&](const auto& path) { return changed(statFile(root / path)); });
+}
+#endif
+
+void GitStats::start() {
+	if (!background || !isRepository())
+		return;
+	async.startNs = nowNs();
+	async.head = getLastCommitHash(repo);
+	// Loading the index now and not refreshing it for the status walk makes the walk compare the working tree against
+	// the index as it was at the start.
+	git_index* index;
+	bool loaded = git_repository_index(&index, repo) == 0;
+	if (loaded) {
+		loaded = git_index_read(index, false) == 0;
+		git_index_free(index);
 	}
-}
\ No newline at end of file
+	if (!loaded)
+		tirex::log::warn("gitstats", "Failed to read the index: {}", git_error_last()->message);
+	async.worker = std::thread([this, loaded]() {
+		lowerThreadPriority();
+		async.stats = collect(async.head, !loaded, &async.files);
+	});
+}
+
+void GitStats::stop() {
+	if (!async.worker.joinable())
+		return;
+	auto begin = std::chrono::steady_clock::now();
+	async.worker.join();
+	auto waited = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - begin);
+	tirex::log::debug("gitstats", "Waited {} ms for the git information to be collected", waited.count());
+#if !defined(_WIN64)
+	bool changed = changedDuringRun();
+	if (changed)
+		tirex::log::warn("gitstats", "The repository changed while tracking, the git information may be inconsistent");
+	async.stats.insert_or_assign(TIREX_GIT_CHANGED_DURING_RUN, changed ? "1"s : "0"s);
+#endif
+}
+
+Stats GitStats::getStats() {
+	if (!background)
+		return {};
+	if (!isRepository())
+		return {{TIREX_GIT_IS_REPO, "0"s}};
+	return async.stats;
+}
+
+Stats GitStats::getInfo() {
+	if (isRepository())
+		return collect(getLastCommitHash(repo), true, nullptr);
+	else
+		return {{TIREX_GIT_IS_REPO, "0"s}};
+}
@@ -3,19 +3,59 @@
 
 #include "provider.hpp"
 
+#include <cstdint>
+#include <string>
+#include <thread>
+#include <vector>
+
 struct git_repository;
 
 namespace tirex {
+	/**
+	 * @brief Collects git related metrics of the repository that contains the working directory.
+	 * @details The git measures are collected by GitStats::getInfo(). If `TIREX_GIT_BACKGROUND` is set, they are also
+	 * collected while tracking: only HEAD and the index are read in GitStats::start() and the expensive part (the
+	 * status walk, hashing and resolving tags) runs on a low priority background thread while the tracked program
+	 * executes. GitStats::stop() then checks whether HEAD, the index or any of the hashed files changed in the meantime
+	 * (TIREX_GIT_CHANGED_DURING_RUN, not supported on Windows). In this mode, the git measures should only be requested
+	 * when tracking and not also when fetching the information, which would collect them twice.
+	 */
 	class GitStats final : public StatsProvider {
 	private:
 		git_repository* repo;
+		const TrackingConf conf;
+		const bool background; /**< Whether the git measures are collected while tracking (see the class) **/
+
+		struct {
+			std::string head;			   /**< The commit HEAD pointed to at the start **/
+			uint64_t startNs = 0;		   /**< When tracking started (in nanoseconds since the epoch) **/
+			std::thread worker;			   /**< Collects the stats while the tracked program executes **/
+			Stats stats;				   /**< The stats collected by the worker **/
+			std::vector<std::string> files; /**< The files that were hashed by the worker **/
+		} async;
+
+		/**
+		 * @brief Collects the requested git measures.
+		 * @param head The hash of the commit to report as TIREX_GIT_LAST_COMMIT_HASH.
+		 * @param refreshIndex Whether the index is reloaded from disk before the status is computed, or the index
+		 * that was loaded before (see GitStats::start()) is used.
+		 * @param files If not null, the files that were hashed are written to it.
+		 */
+		Stats collect(const std::string& head, bool refreshIndex, std::vector<std::string>* files);
+#if !defined(_WIN64)
+		/** @brief Returns true if HEAD, the index or any of the hashed files changed since tracking started. **/
+		bool changedDuringRun() const;
+#endif
 
 	public:
-		GitStats();
+		explicit GitStats(const TrackingConf& conf);
 		~GitStats();
 
 		bool isRepository() const noexcept;
 
+		void start() override;
+		void stop() override;
+		Stats getStats() override;
 		Stats getInfo() override;
 
 		static constexpr const char* description = "Collects git related metrics.";
@@ -24,4 +64,4 @@ namespace tirex {
 	};
 } // namespace tirex
 
-#endif
\ No newline at end of file
+#endif
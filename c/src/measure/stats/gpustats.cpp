@@ -1,20 +1,58 @@
 #include "gpustats.hpp"
 
 #include "../../logging.hpp"
+#include "../utils/infocache.hpp"
+#include "../utils/rangeutils.hpp"
 #include "../utils/sharedlib.hpp"
 
 #include <nvml/nvml.h>
 
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <map>
+#include <numeric>
+#include <set>
+#include <tuple>
+
+#if __linux__
+#include "../utils/procfs.hpp"
+#elif !defined(_WIN64)
+#include <unistd.h>
+#endif
+
 using namespace std::literals;
 
 using tirex::GPUStats;
 using tirex::Stats;
 
 const char* GPUStats::version = "nvml v." NVML_API_VERSION_STR;
-const std::set<tirexMeasure> GPUStats::measures{TIREX_GPU_SUPPORTED,		   TIREX_GPU_MODEL_NAME,
-												TIREX_GPU_NUM_CORES,		   TIREX_GPU_USED_PROCESS_PERCENT,
-												TIREX_GPU_USED_SYSTEM_PERCENT, TIREX_GPU_VRAM_USED_PROCESS_MB,
-												TIREX_GPU_VRAM_USED_SYSTEM_MB, TIREX_GPU_VRAM_AVAILABLE_SYSTEM_MB};
+const std::set<tirexMeasure> GPUStats::measures{
+		TIREX_GPU_SUPPORTED,
+		TIREX_GPU_MODEL_NAME,
+		TIREX_GPU_NUM_CORES,
+		TIREX_GPU_USED_PROCESS_PERCENT,
+		TIREX_GPU_USED_SYSTEM_PERCENT,
+		TIREX_GPU_VRAM_USED_PROCESS_MB,
+		TIREX_GPU_VRAM_USED_SYSTEM_MB,
+		TIREX_GPU_VRAM_AVAILABLE_SYSTEM_MB,
+		TIREX_GPU_USED_DEVICES_PERCENT,
+		TIREX_GPU_USED_PROCESS_DEVICES_PERCENT,
+		TIREX_GPU_VRAM_USED_DEVICES_MB,
+		TIREX_GPU_VRAM_USED_PROCESS_DEVICES_MB,
+		TIREX_GPU_USED_SAMPLES_PERCENT,
+		TIREX_GPU_MEMORY_USED_SAMPLES_PERCENT,
+		TIREX_GPU_POWER_SAMPLES_WATTS,
+		TIREX_GPU_ENERGY_SYSTEM_JOULES,
+		TIREX_GPU_CLOCK_SM_MHZ,
+		TIREX_GPU_CLOCK_MEMORY_MHZ,
+		TIREX_GPU_POWER_WATTS,
+		TIREX_GPU_TEMPERATURE_CELSIUS,
+		TIREX_GPU_MEMORY_TEMPERATURE_CELSIUS,
+		TIREX_GPU_PCIE_TX_KBPS,
+		TIREX_GPU_PCIE_RX_KBPS,
+		TIREX_GPU_THROTTLE_REASONS
+};
 
 struct NVMLLib final : tirex::utils::SharedLib {
 public:
@@ -45,6 +83,42 @@ public:
 			load<NVML_DEVICE_GET_UTILIZATION_RATES>({"nvmlDeviceGetUtilizationRates"});
 	using DEVICE_GET_MEMORY_INFO = nvmlReturn_t (*)(nvmlDevice_t device, nvmlMemory_t* memory);
 	DEVICE_GET_MEMORY_INFO deviceGetMemoryInfo = load<DEVICE_GET_MEMORY_INFO>({"nvmlDeviceGetMemoryInfo"});
+	using DEVICE_GET_COMPUTE_RUNNING_PROCESSES =
+			nvmlReturn_t (*)(nvmlDevice_t device, unsigned int* infoCount, nvmlProcessInfo_t* infos);
+	DEVICE_GET_COMPUTE_RUNNING_PROCESSES deviceGetComputeRunningProcesses =
+			load<DEVICE_GET_COMPUTE_RUNNING_PROCESSES>({"nvmlDeviceGetComputeRunningProcesses_v3"});
+	using DEVICE_GET_PROCESS_UTILIZATION = nvmlReturn_t (*)(
+			nvmlDevice_t device, nvmlProcessUtilizationSample_t* utilization, unsigned int* processSamplesCount,
+			unsigned long long lastSeenTimeStamp
+	);
+	DEVICE_GET_PROCESS_UTILIZATION deviceGetProcessUtilization =
+			load<DEVICE_GET_PROCESS_UTILIZATION>({"nvmlDeviceGetProcessUtilization"});
+	using DEVICE_GET_SAMPLES = nvmlReturn_t (*)(
+			nvmlDevice_t device, nvmlSamplingType_t type, unsigned long long lastSeenTimeStamp,
+			nvmlValueType_t* sampleValType, unsigned int* sampleCount, nvmlSample_t* samples
+	);
+	DEVICE_GET_SAMPLES deviceGetSamples = load<DEVICE_GET_SAMPLES>({"nvmlDeviceGetSamples"});
+	using DEVICE_GET_FIELD_VALUES = nvmlReturn_t (*)(nvmlDevice_t device, int valuesCount, nvmlFieldValue_t* values);
+	DEVICE_GET_FIELD_VALUES deviceGetFieldValues = load<DEVICE_GET_FIELD_VALUES>({"nvmlDeviceGetFieldValues"});
+	using DEVICE_GET_CLOCK_INFO = nvmlReturn_t (*)(nvmlDevice_t device, nvmlClockType_t type, unsigned int* clock);
+	DEVICE_GET_CLOCK_INFO deviceGetClockInfo = load<DEVICE_GET_CLOCK_INFO>({"nvmlDeviceGetClockInfo"});
+	using DEVICE_GET_TEMPERATURE =
+			nvmlReturn_t (*)(nvmlDevice_t device, nvmlTemperatureSensors_t sensorType, unsigned int* temp);
+	DEVICE_GET_TEMPERATURE deviceGetTemperature = load<DEVICE_GET_TEMPERATURE>({"nvmlDeviceGetTemperature"});
+	using DEVICE_GET_PCIE_THROUGHPUT =
+			nvmlReturn_t (*)(nvmlDevice_t device, nvmlPcieUtilCounter_t counter, unsigned int* value);
+	DEVICE_GET_PCIE_THROUGHPUT deviceGetPcieThroughput =
+			load<DEVICE_GET_PCIE_THROUGHPUT>({"nvmlDeviceGetPcieThroughput"});
+	using DEVICE_GET_CURRENT_CLOCKS_THROTTLE_REASONS =
+			nvmlReturn_t (*)(nvmlDevice_t device, unsigned long long* clocksThrottleReasons);
+	DEVICE_GET_CURRENT_CLOCKS_THROTTLE_REASONS deviceGetCurrentClocksThrottleReasons =
+			load<DEVICE_GET_CURRENT_CLOCKS_THROTTLE_REASONS>({"nvmlDeviceGetCurrentClocksThrottleReasons"});
+	/** The fallbacks if the driver does not provide nvmlDeviceGetFieldValues **/
+	using DEVICE_GET_POWER_USAGE = nvmlReturn_t (*)(nvmlDevice_t device, unsigned int* power);
+	DEVICE_GET_POWER_USAGE deviceGetPowerUsage = load<DEVICE_GET_POWER_USAGE>({"nvmlDeviceGetPowerUsage"});
+	using DEVICE_GET_TOTAL_ENERGY_CONSUMPTION = nvmlReturn_t (*)(nvmlDevice_t device, unsigned long long* energy);
+	DEVICE_GET_TOTAL_ENERGY_CONSUMPTION deviceGetTotalEnergyConsumption =
+			load<DEVICE_GET_TOTAL_ENERGY_CONSUMPTION>({"nvmlDeviceGetTotalEnergyConsumption"});
 
 #if defined(__linux__)
 	NVMLLib() : tirex::utils::SharedLib("libnvidia-ml.so.1") {}
@@ -100,9 +174,166 @@ static bool initNVML() {
 	return false;
 }
 
-GPUStats::GPUStats() : nvml({.supported = initNVML(), .devices = {}}) {
-	if (!nvml.supported)
+/** The names of the metrics of GPUStats::Metric for logging **/
+static constexpr const char* metricNames[] = {
+		"memory information", "utilization", "power draw", "total energy consumption", "memory temperature",
+		"power policy throttle time", "thermal policy throttle time", "SM clock", "memory clock", "temperature",
+		"PCIe TX throughput", "PCIe RX throughput", "throttle reasons"
+};
+
+/** The field IDs of the metrics that are fetched with nvmlDeviceGetFieldValues (Metric::Power and following) **/
+static constexpr unsigned fieldIds[] = {
+		NVML_FI_DEV_POWER_INSTANT, NVML_FI_DEV_TOTAL_ENERGY_CONSUMPTION, NVML_FI_DEV_MEMORY_TEMP,
+		NVML_FI_DEV_PERF_POLICY_POWER, NVML_FI_DEV_PERF_POLICY_THERMAL
+};
+
+static const std::pair<unsigned long long, const char*> throttleReasons[] = {
+		{nvmlClocksThrottleReasonGpuIdle, "gpu_idle"},
+		{nvmlClocksThrottleReasonApplicationsClocksSetting, "applications_clocks_setting"},
+		{nvmlClocksThrottleReasonSwPowerCap, "sw_power_cap"},
+		{nvmlClocksThrottleReasonHwSlowdown, "hw_slowdown"},
+		{nvmlClocksThrottleReasonSyncBoost, "sync_boost"},
+		{nvmlClocksThrottleReasonSwThermalSlowdown, "sw_thermal_slowdown"},
+		{nvmlClocksThrottleReasonHwThermalSlowdown, "hw_thermal_slowdown"},
+		{nvmlClocksThrottleReasonHwPowerBrakeSlowdown, "hw_power_brake_slowdown"},
+		{nvmlClocksThrottleReasonDisplayClockSetting, "display_clock_setting"}
+};
+
+static double toDouble(nvmlValueType_t type, const nvmlValue_t& value) {
+	switch (type) {
+	case NVML_VALUE_TYPE_DOUBLE:
+		return value.dVal;
+	case NVML_VALUE_TYPE_UNSIGNED_INT:
+		return value.uiVal;
+	case NVML_VALUE_TYPE_UNSIGNED_LONG:
+		return static_cast<double>(value.ulVal);
+	case NVML_VALUE_TYPE_UNSIGNED_LONG_LONG:
+		return static_cast<double>(value.ullVal);
+	case NVML_VALUE_TYPE_SIGNED_LONG_LONG:
+		return static_cast<double>(value.sllVal);
+	case NVML_VALUE_TYPE_SIGNED_INT:
+		return value.siVal;
+	default:
+		return 0;
+	}
+}
+
+/**
+ * @brief Converts a timestamp reported by NVML (in microseconds since the epoch) into the clock of the time series.
+ */
+static tirex::TimeSeriesMatrix<unsigned>::clock::time_point toTimePoint(unsigned long long timestampUs) {
+	using clock = tirex::TimeSeriesMatrix<unsigned>::clock;
+	auto age = std::chrono::system_clock::now() -
+			   std::chrono::system_clock::time_point(std::chrono::microseconds(timestampUs));
+	return clock::now() - std::chrono::duration_cast<clock::duration>(age);
+}
+
+static unsigned long long nowUs() {
+	auto now = std::chrono::system_clock::now().time_since_epoch();
+	return static_cast<unsigned long long>(std::chrono::duration_cast<std::chrono::microseconds>(now).count());
+}
+
+/**
+ * @brief Returns the IDs of the tracked processes and, on Linux, of all of their children.
+ */
+static std::set<unsigned> listTrackedProcesses(const std::vector<uint32_t>& pids) {
+#if __linux__
+	namespace procfs = tirex::utils::procfs;
+	auto tree = procfs::listProcessTree(procfs::toPids(pids));
+	return {tree.begin(), tree.end()};
+#else
+	/** \todo: also collect the children on other platforms */
+	if (!pids.empty())
+		return {pids.begin(), pids.end()};
+#if defined(_WIN64)
+	return {static_cast<unsigned>(GetCurrentProcessId())};
+#else
+	return {static_cast<unsigned>(getpid())};
+#endif
+#endif
+}
+
+/**
+ * @brief Returns the VRAM (in bytes) used by the given processes on the device.
+ */
+static unsigned long long getProcessVram(nvmlDevice_t device, const std::set<unsigned>& processes) {
+	if (nvml.deviceGetComputeRunningProcesses == nullptr)
+		return 0;
+	std::vector<nvmlProcessInfo_t> infos(16);
+	unsigned count;
+	nvmlReturn_t ret;
+	do {
+		count = static_cast<unsigned>(infos.size());
+		// New processes may appear between the calls, so we reserve some extra space
+		if ((ret = nvml.deviceGetComputeRunningProcesses(device, &count, infos.data())) == NVML_ERROR_INSUFFICIENT_SIZE)
+			infos.resize(count + 8);
+	} while (ret == NVML_ERROR_INSUFFICIENT_SIZE);
+	if (ret != NVML_SUCCESS) {
+		tirex::log::debug("gpustats", "Could not fetch the running processes: {}", nvml.errorString(ret));
+		return 0;
+	}
+	unsigned long long used = 0;
+	for (unsigned i = 0; i < count; ++i) {
+		// The memory usage is not available, e.g., on Windows (WDDM) or if the process belongs to another container
+		if (processes.contains(infos[i].pid) &&
+			infos[i].usedGpuMemory != static_cast<unsigned long long>(NVML_VALUE_NOT_AVAILABLE))
+			used += infos[i].usedGpuMemory;
+	}
+	return used;
+}
+
+/**
+ * @brief Returns the SM utilization (in percent) of the device caused by the given processes since \p lastSeen and
+ * updates \p lastSeen to the timestamp of the most recent sample.
+ */
+static unsigned getProcessUtilization(
+		nvmlDevice_t device, const std::set<unsigned>& processes, unsigned long long& lastSeen
+) {
+	if (nvml.deviceGetProcessUtilization == nullptr)
+		return 0;
+	unsigned count = 0;
+	auto ret = nvml.deviceGetProcessUtilization(device, nullptr, &count, lastSeen);
+	if (ret != NVML_ERROR_INSUFFICIENT_SIZE || count == 0)
+		return 0; // NVML_ERROR_NOT_FOUND means that no process used the device since lastSeen
+	std::vector<nvmlProcessUtilizationSample_t> samples(count);
+	if ((ret = nvml.deviceGetProcessUtilization(device, samples.data(), &count, lastSeen)) != NVML_SUCCESS) {
+		tirex::log::debug("gpustats", "Could not fetch the process utilization: {}", nvml.errorString(ret));
+		return 0;
+	}
+	// Each sample covers a single process; if a process has multiple samples, its utilization is averaged
+	std::map<unsigned, std::pair<unsigned, unsigned>> utilization; // pid -> (sum, number of samples)
+	for (unsigned i = 0; i < count; ++i) {
+		lastSeen = std::max(lastSeen, samples[i].timeStamp);
+		if (processes.contains(samples[i].pid)) {
+			auto& [sum, num] = utilization[samples[i].pid];
+			sum += samples[i].smUtil;
+			++num;
+		}
+	}
+	unsigned total = 0;
+	for (const auto& [pid, value] : utilization)
+		total += value.first / value.second;
+	return std::min(total, 100u);
+}
+
+GPUStats::GPUStats(const TrackingConf& conf)
+		: pids(conf.pids), unrequested(getUnrequested(conf)),
+		  processes(conf.requested(
+				  {TIREX_GPU_USED_PROCESS_PERCENT, TIREX_GPU_VRAM_USED_PROCESS_MB,
+				   TIREX_GPU_USED_PROCESS_DEVICES_PERCENT, TIREX_GPU_VRAM_USED_PROCESS_DEVICES_MB}
+		  )) {}
+
+void GPUStats::init() {
+	if (initialized)
+		return;
+	initialized = true;
+	nvml.supported = initNVML();
+	if (!nvml.supported) {
+#if __linux__
+		initAMD();
+#endif
 		return;
+	}
 	unsigned int count;
 	switch (::nvml.deviceGetCount(&count)) {
 	case NVML_SUCCESS:
@@ -117,6 +348,9 @@ GPUStats::GPUStats() : nvml({.supported = initNVML(), .devices = {}}) {
 				::nvml.deviceGetName(device, name, sizeof(name) - 1);
 				tirex::log::info("gpustats", "\t[{}] {} ({} Architecture)", i, name, nvmlArchToStr(arch));
 				nvml.devices.emplace_back(device);
+				addColumn(std::to_string(i));
+				for (auto series : {&nvml.utilizationSamples, &nvml.memoryUtilizationSamples, &nvml.powerSamples})
+					series->samples.column(std::to_string(i));
 				break;
 			default:
 				tirex::log::error(
@@ -126,46 +360,485 @@ GPUStats::GPUStats() : nvml({.supported = initNVML(), .devices = {}}) {
 			}
 		}
 	}
+	nvml.lastProcessSample.assign(nvml.devices.size(), 0);
+	state.resize(nvml.devices.size());
+	for (auto series : {&nvml.utilizationSamples, &nvml.memoryUtilizationSamples, &nvml.powerSamples}) {
+		series->current.assign(nvml.devices.size(), 0);
+		series->lastSeen.assign(nvml.devices.size(), 0);
+	}
+	if (auto env = std::getenv("TIREX_GPU_SAMPLES_STEP_INTERVAL"); env != nullptr)
+		nvml.sampleInterval = std::strtoul(env, nullptr, 10);
+	if (nvml.sampleInterval != 0 && ::nvml.deviceGetSamples == nullptr) {
+		tirex::log::warn(
+				"gpustats", "The driver does not support fetching samples, querying the current values instead"
+		);
+		nvml.sampleInterval = 0;
+	}
+#if __linux__
+	initAMD();
+#endif
+}
+
+std::bitset<GPUStats::NumMetrics> GPUStats::getUnrequested(const TrackingConf& conf) {
+	std::bitset<NumMetrics> unrequested;
+	for (auto [metric, requested] :
+		 {std::pair{MemoryInfo, conf.requested({TIREX_GPU_VRAM_USED_SYSTEM_MB, TIREX_GPU_VRAM_USED_DEVICES_MB})},
+		  std::pair{Utilization, conf.requested({TIREX_GPU_USED_SYSTEM_PERCENT, TIREX_GPU_USED_DEVICES_PERCENT})},
+		  std::pair{Power, conf.requested({TIREX_GPU_POWER_WATTS})},
+		  std::pair{Energy, conf.requested({TIREX_GPU_ENERGY_SYSTEM_JOULES})},
+		  std::pair{MemoryTemperature, conf.requested({TIREX_GPU_MEMORY_TEMPERATURE_CELSIUS})},
+		  std::pair{PowerThrottleTime, conf.requested({TIREX_GPU_THROTTLE_REASONS})},
+		  std::pair{ThermalThrottleTime, conf.requested({TIREX_GPU_THROTTLE_REASONS})},
+		  std::pair{SmClock, conf.requested({TIREX_GPU_CLOCK_SM_MHZ})},
+		  std::pair{MemoryClock, conf.requested({TIREX_GPU_CLOCK_MEMORY_MHZ})},
+		  std::pair{Temperature, conf.requested({TIREX_GPU_TEMPERATURE_CELSIUS})},
+		  std::pair{PcieTx, conf.requested({TIREX_GPU_PCIE_TX_KBPS})},
+		  std::pair{PcieRx, conf.requested({TIREX_GPU_PCIE_RX_KBPS})},
+		  std::pair{ThrottleReasons, conf.requested({TIREX_GPU_THROTTLE_REASONS})}}) {
+		unrequested[metric] = !requested;
+	}
+	return unrequested;
+}
+
+void GPUStats::addColumn(const std::string& label) {
+	for (auto matrix :
+		 {&nvml.deviceVramUsageTotal, &nvml.deviceVramUsageProcess, &nvml.deviceUtilizationTotal,
+		  &nvml.deviceUtilizationProcess, &nvml.smClock, &nvml.memoryClock, &nvml.power, &nvml.temperature,
+		  &nvml.memoryTemperature, &nvml.pcieTx, &nvml.pcieRx})
+		matrix->column(label);
+}
+
+bool GPUStats::available() const {
+#if __linux__
+	return nvml.supported || !amd.cards.empty();
+#else
+	return nvml.supported;
+#endif
+}
+
+#if __linux__
+void GPUStats::initAMD() {
+	namespace amdgpu = tirex::utils::amdgpu;
+	amd.cards = amdgpu::listCards();
+	if (amd.cards.empty())
+		return;
+	tirex::log::info("gpustats", "Found {} AMD device(s):", amd.cards.size());
+	for (const auto& card : amd.cards) {
+		tirex::log::info("gpustats", "\t[{}] {}", card.name, amdgpu::readName(card));
+		addColumn(card.name);
+		// The files that exist depend on the generation of the GPU, which is why we probe them once
+		auto& info = state.emplace_back();
+		info.unsupported.set(); // Throttling and PCIe throughput are not provided (pcie_bw blocks for a second)
+		for (auto [metric, available] :
+			 {std::pair{MemoryInfo, amdgpu::readVramUsed(card).has_value()},
+			  std::pair{Utilization, amdgpu::readBusyPercent(card).has_value()},
+			  std::pair{Power, amdgpu::readPower(card).has_value()},
+			  std::pair{Energy, amdgpu::readEnergy(card) || amdgpu::readPower(card)},
+			  std::pair{Temperature, amdgpu::readTemperature(card, "edge").has_value()},
+			  std::pair{MemoryTemperature, amdgpu::readTemperature(card, "mem").has_value()},
+			  std::pair{SmClock, amdgpu::readClock(card, 1).has_value()},
+			  std::pair{MemoryClock, amdgpu::readClock(card, 2).has_value()}}) {
+			if (available)
+				info.unsupported.reset(metric);
+		}
+	}
+	amd.lastGfxNs.resize(amd.cards.size());
+}
+
+void GPUStats::updateAMDEnergy() {
+	namespace amdgpu = tirex::utils::amdgpu;
+	auto now = std::chrono::steady_clock::now();
+	auto seconds = std::chrono::duration<double>(now - amd.lastUpdate).count();
+	amd.lastUpdate = now;
+	for (size_t i = 0; i < amd.cards.size(); ++i) {
+		auto& info = state[nvml.devices.size() + i];
+		auto power = amdgpu::readPower(amd.cards[i]);
+		info.lastFields[Power] = power ? std::optional(*power / 1000) : std::nullopt; // In milliwatts
+		if (auto energy = amdgpu::readEnergy(amd.cards[i])) {
+			info.lastFields[Energy] = *energy / 1000; // In millijoules
+		} else if (power) {
+			// Without an energy counter, the average power since the last update is approximated by the current one
+			auto& joules = info.lastFields[Energy];
+			joules = joules.value_or(0) + static_cast<unsigned long long>(*power / 1000 * seconds);
+		}
+	}
+}
+#endif
+
+std::vector<unsigned> GPUStats::fetchSamples(unsigned samplingType, SampledSeries& series, double scale) {
+	auto type = static_cast<nvmlSamplingType_t>(samplingType);
+	std::vector<std::tuple<unsigned long long, size_t, unsigned>> samples; // (timestamp, device, value)
+	std::vector<unsigned> averages = series.current;
+	for (size_t i = 0; i < nvml.devices.size(); ++i) {
+		nvmlValueType_t valueType;
+		unsigned count = 0;
+		// Without a buffer, the call returns the number of samples that are available
+		auto ret = ::nvml.deviceGetSamples(nvml.devices[i], type, series.lastSeen[i], &valueType, &count, nullptr);
+		if (ret != NVML_SUCCESS || count == 0)
+			continue; // NVML_ERROR_NOT_FOUND means that there are no new samples
+		std::vector<nvmlSample_t> buffer(count);
+		ret = ::nvml.deviceGetSamples(nvml.devices[i], type, series.lastSeen[i], &valueType, &count, buffer.data());
+		if (ret != NVML_SUCCESS) {
+			tirex::log::debug("gpustats", "Could not fetch samples: {}", ::nvml.errorString(ret));
+			continue;
+		}
+		double sum = 0;
+		size_t num = 0;
+		for (unsigned j = 0; j < count; ++j) {
+			if (buffer[j].timeStamp <= series.lastSeen[i])
+				continue;
+			auto value = static_cast<unsigned>(toDouble(valueType, buffer[j].sampleValue) * scale);
+			samples.emplace_back(buffer[j].timeStamp, i, value);
+			sum += value;
+			++num;
+		}
+		if (num != 0)
+			averages[i] = static_cast<unsigned>(sum / static_cast<double>(num));
+	}
+	std::ranges::sort(samples);
+	for (const auto& [timestamp, device, value] : samples) {
+		series.current[device] = value;
+		series.lastSeen[device] = std::max(series.lastSeen[device], timestamp);
+		series.samples.addRow(std::vector(series.current), toTimePoint(timestamp));
+	}
+	return averages;
+}
+
+bool GPUStats::check(size_t device, Metric metric, int result) {
+	auto ret = static_cast<nvmlReturn_t>(result);
+	switch (ret) {
+	case NVML_SUCCESS:
+		return true;
+	case NVML_ERROR_NOT_SUPPORTED:
+	case NVML_ERROR_NO_PERMISSION:
+	case NVML_ERROR_FUNCTION_NOT_FOUND:
+	case NVML_ERROR_INVALID_ARGUMENT: // E.g., a field ID that is unknown to the driver
+		tirex::log::info(
+				"gpustats", "[{}] Fetching the {} is not supported: {}", device, metricNames[metric],
+				::nvml.errorString(ret)
+		);
+		state[device].unsupported.set(metric);
+		return false;
+	case NVML_ERROR_GPU_IS_LOST:
+		tirex::log::error("gpustats", "[{}] The device fell off the bus, it is no longer queried", device);
+		state[device].unsupported.set();
+		return false;
+	default: // Transient errors, the metric is reported as 0 for this step
+		tirex::log::debug(
+				"gpustats", "[{}] Could not fetch the {}: {}", device, metricNames[metric], ::nvml.errorString(ret)
+		);
+		return false;
+	}
+}
+
+bool GPUStats::anySupports(Metric metric) const {
+	for (size_t i = 0; i < state.size(); ++i) {
+		if (supported(i, metric))
+			return true;
+	}
+	return false;
+}
+
+void GPUStats::queryFields(size_t device) {
+	auto& info = state[device];
+	if (::nvml.deviceGetFieldValues == nullptr) {
+		// Older drivers only provide dedicated queries for some of the fields
+		unsigned power;
+		if (supported(device, Power) &&
+			check(device, Power,
+				  ::nvml.deviceGetPowerUsage ? ::nvml.deviceGetPowerUsage(nvml.devices[device], &power)
+											 : NVML_ERROR_FUNCTION_NOT_FOUND))
+			info.lastFields[Power] = power;
+		unsigned long long energy;
+		if (supported(device, Energy) &&
+			check(device, Energy,
+				  ::nvml.deviceGetTotalEnergyConsumption
+						  ? ::nvml.deviceGetTotalEnergyConsumption(nvml.devices[device], &energy)
+						  : NVML_ERROR_FUNCTION_NOT_FOUND))
+			info.lastFields[Energy] = energy;
+		for (auto metric : {MemoryTemperature, PowerThrottleTime, ThermalThrottleTime})
+			info.unsupported.set(metric);
+		return;
+	}
+	std::vector<nvmlFieldValue_t> values;
+	std::vector<Metric> metrics;
+	for (size_t metric = Power; metric <= ThermalThrottleTime; ++metric) {
+		if (supported(device, static_cast<Metric>(metric))) {
+			values.emplace_back().fieldId = fieldIds[metric - Power];
+			metrics.emplace_back(static_cast<Metric>(metric));
+		}
+	}
+	if (values.empty())
+		return;
+	auto ret = ::nvml.deviceGetFieldValues(nvml.devices[device], static_cast<int>(values.size()), values.data());
+	if (ret != NVML_SUCCESS) {
+		tirex::log::debug("gpustats", "[{}] Could not fetch the field values: {}", device, ::nvml.errorString(ret));
+		return;
+	}
+	for (size_t i = 0; i < values.size(); ++i) {
+		if (check(device, metrics[i], values[i].nvmlReturn))
+			info.lastFields[metrics[i]] =
+					static_cast<unsigned long long>(toDouble(values[i].valueType, values[i].value));
+	}
+}
+
+void GPUStats::start() {
+	init();
+	if (nvml.supported) {
+		// Skip the process utilization samples that NVML buffered before tracking started
+		for (size_t i = 0; i < nvml.devices.size(); ++i)
+			getProcessUtilization(nvml.devices[i], {}, nvml.lastProcessSample[i]);
+		for (auto series : {&nvml.utilizationSamples, &nvml.memoryUtilizationSamples, &nvml.powerSamples})
+			series->lastSeen.assign(nvml.devices.size(), nowUs());
+		for (size_t i = 0; i < nvml.devices.size(); ++i)
+			queryFields(i);
+	}
+#if __linux__
+	if (!amd.cards.empty()) {
+		amd.lastUpdate = std::chrono::steady_clock::now();
+		updateAMDEnergy();
+		// Only the time the clients keep the GPU busy from now on is accounted to the tracked processes
+		auto processes = listTrackedProcesses(pids);
+		auto clients = tirex::utils::amdgpu::readClients({processes.begin(), processes.end()});
+		for (size_t i = 0; i < amd.cards.size(); ++i) {
+			for (const auto& [id, usage] : clients[amd.cards[i].pciAddress])
+				amd.lastGfxNs[i][id] = usage.gfxNs;
+		}
+	}
+#endif
+	// The energy and throttle times are counters, so we need to know where they were when tracking started
+	for (auto& info : state)
+		info.startFields = info.lastFields;
+}
+
+void GPUStats::stop() {
+	for (size_t i = 0; i < nvml.devices.size(); ++i)
+		queryFields(i);
+#if __linux__
+	if (!amd.cards.empty())
+		updateAMDEnergy();
+#endif
 }
 
 void GPUStats::step() {
-	if (!nvml.supported)
+	if (!available() || (nvml.sampleInterval != 0 && (++nvml.numSteps % nvml.sampleInterval) != 0))
 		return;
-	nvmlMemory_t memory;
-	/** \todo support multi-gpu **/
-	for (auto device : nvml.devices) {
-		if (nvmlReturn_t ret; (ret = ::nvml.deviceGetMemoryInfo(device, &memory)) == NVML_SUCCESS) {
-			nvml.vramUsageTotal.addValue(memory.used / 1000 / 1000);
+	std::vector<unsigned> sampledUtilization;
+	if (nvml.sampleInterval != 0) {
+		sampledUtilization = fetchSamples(NVML_GPU_UTILIZATION_SAMPLES, nvml.utilizationSamples, 1);
+		fetchSamples(NVML_MEMORY_UTILIZATION_SAMPLES, nvml.memoryUtilizationSamples, 1);
+		fetchSamples(NVML_TOTAL_POWER_SAMPLES, nvml.powerSamples, 1 / 1000.0); // The samples are in milliwatts
+	}
+	auto processes = this->processes ? listTrackedProcesses(pids) : std::set<unsigned>{};
+	std::vector<unsigned> vramTotal, vramProcess, utilTotal, utilProcess;
+	std::vector<unsigned> smClock, memoryClock, power, temperature, memoryTemperature, pcieTx, pcieRx;
+	for (size_t i = 0; i < nvml.devices.size(); ++i) {
+		auto device = nvml.devices[i];
+		auto& info = state[i];
+		// Metrics that are not supported or could not be fetched are reported as 0
+		nvmlMemory_t memory{};
+		if (supported(i, MemoryInfo))
+			check(i, MemoryInfo, ::nvml.deviceGetMemoryInfo(device, &memory));
+		vramTotal.emplace_back(static_cast<unsigned>(memory.used / 1000 / 1000));
+		nvmlUtilization_t util{};
+		if (!sampledUtilization.empty())
+			util.gpu = sampledUtilization[i];
+		else if (supported(i, Utilization))
+			check(i, Utilization, ::nvml.deviceGetUtilizationRates(device, &util));
+		utilTotal.emplace_back(util.gpu);
+		if (this->processes) {
+			vramProcess.emplace_back(static_cast<unsigned>(getProcessVram(device, processes) / 1000 / 1000));
+			utilProcess.emplace_back(getProcessUtilization(device, processes, nvml.lastProcessSample[i]));
 		} else {
-			tirex::log::critical("gpustats", "Could not fetch memory information: {}", ::nvml.errorString(ret));
-			abort(); /** \todo how to handle? **/
+			vramProcess.emplace_back(0);
+			utilProcess.emplace_back(0);
 		}
-		nvmlUtilization_t util;
-		if (nvmlReturn_t ret; (ret = ::nvml.deviceGetUtilizationRates(device, &util)) == NVML_SUCCESS) {
-			nvml.utilizationTotal.addValue(util.gpu);
-		} else {
-			tirex::log::critical("gpustats", "Could not fetch utilization information: {}", ::nvml.errorString(ret));
-			abort(); /** \todo how to handle? **/
+
+		info.lastFields[Power].reset();
+		info.lastFields[MemoryTemperature].reset();
+		queryFields(i);
+		power.emplace_back(static_cast<unsigned>(info.lastFields[Power].value_or(0) / 1000)); // In milliwatts
+		memoryTemperature.emplace_back(static_cast<unsigned>(info.lastFields[MemoryTemperature].value_or(0)));
+		auto query = [this, i]<typename Fn, typename... Args>(Metric metric, Fn fn, Args... args) -> unsigned {
+			unsigned value = 0;
+			if (supported(i, metric))
+				check(i, metric, fn ? fn(nvml.devices[i], args..., &value) : NVML_ERROR_FUNCTION_NOT_FOUND);
+			return value;
+		};
+		smClock.emplace_back(query(SmClock, ::nvml.deviceGetClockInfo, NVML_CLOCK_SM));
+		memoryClock.emplace_back(query(MemoryClock, ::nvml.deviceGetClockInfo, NVML_CLOCK_MEM));
+		temperature.emplace_back(query(Temperature, ::nvml.deviceGetTemperature, NVML_TEMPERATURE_GPU));
+		pcieTx.emplace_back(query(PcieTx, ::nvml.deviceGetPcieThroughput, NVML_PCIE_UTIL_TX_BYTES));
+		pcieRx.emplace_back(query(PcieRx, ::nvml.deviceGetPcieThroughput, NVML_PCIE_UTIL_RX_BYTES));
+		if (unsigned long long reasons; supported(i, ThrottleReasons) &&
+										check(i, ThrottleReasons,
+											  ::nvml.deviceGetCurrentClocksThrottleReasons
+													  ? ::nvml.deviceGetCurrentClocksThrottleReasons(device, &reasons)
+													  : NVML_ERROR_FUNCTION_NOT_FOUND)) {
+			++info.throttleSteps[0]; // The number of steps in which the reasons were queried
+			for (const auto& [reason, name] : throttleReasons) {
+				if (reasons & reason)
+					++info.throttleSteps[reason];
+			}
 		}
 	}
+#if __linux__
+	if (!amd.cards.empty()) {
+		namespace amdgpu = tirex::utils::amdgpu;
+		auto elapsedNs = static_cast<uint64_t>(
+				std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - amd.lastUpdate)
+						.count()
+		);
+		auto clients = amdgpu::readClients({processes.begin(), processes.end()});
+		updateAMDEnergy();
+		for (size_t j = 0; j < amd.cards.size(); ++j) {
+			const auto& card = amd.cards[j];
+			auto device = nvml.devices.size() + j;
+			const auto& info = state[device];
+			// Only the files of the metrics that are supported and requested are read, the others are reported as 0
+			auto read = [this, device](Metric metric, auto fn) -> unsigned {
+				if (!supported(device, metric))
+					return 0;
+				return static_cast<unsigned>(std::max<int64_t>(static_cast<int64_t>(fn().value_or(0)), 0));
+			};
+			vramTotal.emplace_back(read(MemoryInfo, [&card] { return amdgpu::readVramUsed(card); }) / 1000 / 1000);
+			utilTotal.emplace_back(read(Utilization, [&card] { return amdgpu::readBusyPercent(card); }));
+			uint64_t vram = 0, busyNs = 0;
+			for (const auto& [id, usage] : clients[card.pciAddress]) {
+				vram += usage.vramBytes;
+				auto& last = amd.lastGfxNs[j][id];
+				busyNs += usage.gfxNs - std::min(last, usage.gfxNs);
+				last = usage.gfxNs;
+			}
+			vramProcess.emplace_back(static_cast<unsigned>(vram / 1000 / 1000));
+			utilProcess.emplace_back(
+					static_cast<unsigned>((elapsedNs != 0) ? std::min<uint64_t>(busyNs * 100 / elapsedNs, 100) : 0)
+			);
+			smClock.emplace_back(read(SmClock, [&card] { return amdgpu::readClock(card, 1); }));
+			memoryClock.emplace_back(read(MemoryClock, [&card] { return amdgpu::readClock(card, 2); }));
+			power.emplace_back(static_cast<unsigned>(info.lastFields[Power].value_or(0) / 1000));
+			temperature.emplace_back(read(Temperature, [&card] { return amdgpu::readTemperature(card, "edge"); }));
+			memoryTemperature.emplace_back(read(MemoryTemperature, [&card] {
+				return amdgpu::readTemperature(card, "mem");
+			}));
+			pcieTx.emplace_back(0);
+			pcieRx.emplace_back(0);
+		}
+	}
+#endif
+	if (state.empty())
+		return;
+	auto sum = [](const std::vector<unsigned>& values) { return std::accumulate(values.begin(), values.end(), 0u); };
+	auto numDevices = static_cast<unsigned>(state.size());
+	nvml.vramUsageTotal.addValue(sum(vramTotal));
+	nvml.vramUsageProcess.addValue(sum(vramProcess));
+	nvml.utilizationTotal.addValue(sum(utilTotal) / numDevices);
+	nvml.utilizationProcess.addValue(sum(utilProcess) / numDevices);
+	nvml.deviceVramUsageTotal.addRow(std::move(vramTotal));
+	nvml.deviceVramUsageProcess.addRow(std::move(vramProcess));
+	nvml.deviceUtilizationTotal.addRow(std::move(utilTotal));
+	nvml.deviceUtilizationProcess.addRow(std::move(utilProcess));
+	nvml.smClock.addRow(std::move(smClock));
+	nvml.memoryClock.addRow(std::move(memoryClock));
+	nvml.power.addRow(std::move(power));
+	nvml.temperature.addRow(std::move(temperature));
+	nvml.memoryTemperature.addRow(std::move(memoryTemperature));
+	nvml.pcieTx.addRow(std::move(pcieTx));
+	nvml.pcieRx.addRow(std::move(pcieRx));
 }
 
 Stats GPUStats::getStats() {
-	/** \todo: filter by requested metrics */
-	if (nvml.supported) {
-		return {
-				{TIREX_GPU_USED_PROCESS_PERCENT, "TODO"s},
+	if (available()) {
+		Stats stats{
+				{TIREX_GPU_USED_PROCESS_PERCENT, nvml.utilizationProcess},
 				{TIREX_GPU_USED_SYSTEM_PERCENT, nvml.utilizationTotal},
-				{TIREX_GPU_VRAM_USED_PROCESS_MB, "TODO"s},
+				{TIREX_GPU_VRAM_USED_PROCESS_MB, nvml.vramUsageProcess},
 				{TIREX_GPU_VRAM_USED_SYSTEM_MB, nvml.vramUsageTotal},
+				{TIREX_GPU_USED_DEVICES_PERCENT, nvml.deviceUtilizationTotal},
+				{TIREX_GPU_USED_PROCESS_DEVICES_PERCENT, nvml.deviceUtilizationProcess},
+				{TIREX_GPU_VRAM_USED_DEVICES_MB, nvml.deviceVramUsageTotal},
+				{TIREX_GPU_VRAM_USED_PROCESS_DEVICES_MB, nvml.deviceVramUsageProcess},
+		};
+		if (nvml.sampleInterval != 0) {
+			stats.insert({TIREX_GPU_USED_SAMPLES_PERCENT, nvml.utilizationSamples.samples});
+			stats.insert({TIREX_GPU_MEMORY_USED_SAMPLES_PERCENT, nvml.memoryUtilizationSamples.samples});
+			stats.insert({TIREX_GPU_POWER_SAMPLES_WATTS, nvml.powerSamples.samples});
+		}
+		// Measures that no device supports are omitted
+		const std::pair<tirexMeasure, std::pair<Metric, const TimeSeriesMatrix<unsigned>*>> matrices[] = {
+				{TIREX_GPU_CLOCK_SM_MHZ, {SmClock, &nvml.smClock}},
+				{TIREX_GPU_CLOCK_MEMORY_MHZ, {MemoryClock, &nvml.memoryClock}},
+				{TIREX_GPU_POWER_WATTS, {Power, &nvml.power}},
+				{TIREX_GPU_TEMPERATURE_CELSIUS, {Temperature, &nvml.temperature}},
+				{TIREX_GPU_MEMORY_TEMPERATURE_CELSIUS, {MemoryTemperature, &nvml.memoryTemperature}},
+				{TIREX_GPU_PCIE_TX_KBPS, {PcieTx, &nvml.pcieTx}},
+				{TIREX_GPU_PCIE_RX_KBPS, {PcieRx, &nvml.pcieRx}},
 		};
+		for (const auto& [measure, series] : matrices) {
+			if (anySupports(series.first))
+				stats.insert({measure, *series.second});
+		}
+		if (anySupports(Energy)) {
+			unsigned long long millijoules = 0;
+			for (const auto& info : state) {
+				if (info.startFields[Energy] && info.lastFields[Energy])
+					millijoules += *info.lastFields[Energy] - *info.startFields[Energy];
+			}
+			stats.insert({TIREX_GPU_ENERGY_SYSTEM_JOULES, _fmt::format("{:.3f}", millijoules / 1000.0)});
+		}
+		if (anySupports(ThrottleReasons) || anySupports(PowerThrottleTime) || anySupports(ThermalThrottleTime)) {
+			std::vector<std::string> devices;
+			for (size_t i = 0; i < nvml.devices.size(); ++i) {
+				const auto& info = state[i];
+				auto steps = info.throttleSteps.contains(0) ? info.throttleSteps.at(0) : 0;
+				std::vector<std::string> entries{_fmt::format("steps: {}", steps)};
+				for (const auto& [reason, name] : throttleReasons) {
+					if (info.throttleSteps.contains(reason))
+						entries.emplace_back(_fmt::format("{}: {}", name, info.throttleSteps.at(reason)));
+				}
+				for (auto [metric, name] : {std::pair{PowerThrottleTime, "power_policy_ms"},
+											std::pair{ThermalThrottleTime, "thermal_policy_ms"}}) {
+					if (info.startFields[metric] && info.lastFields[metric])
+						entries.emplace_back(_fmt::format(
+								"{}: {}", name, (*info.lastFields[metric] - *info.startFields[metric]) / 1000000
+						));
+				}
+				devices.emplace_back(_fmt::format("{}: {{{}}}", i, tirex::utils::join(entries, ',')));
+			}
+			stats.insert({TIREX_GPU_THROTTLE_REASONS, "{" + tirex::utils::join(devices, ',') + "}"});
+		}
+		return stats;
 	} else {
 		return {};
 	}
 }
+/**
+ * @brief Identifies the GPUs that are visible to this process without loading the drivers, such that containers that
+ * share the boot ID of the host but were assigned different GPUs do not share their cached information.
+ */
+static std::string listVisibleDevices() {
+	std::vector<std::string> devices;
+	for (auto var : {"CUDA_VISIBLE_DEVICES", "NVIDIA_VISIBLE_DEVICES"}) {
+		if (auto env = std::getenv(var); env != nullptr)
+			devices.emplace_back(_fmt::format("{}={}", var, env));
+	}
+#if __linux__
+	// Only the device nodes of the assigned NVIDIA GPUs are passed into a container
+	for (const auto& node : tirex::utils::sysfs::listNumbered("/dev", "nvidia"))
+		devices.emplace_back(node.filename().string());
+	for (const auto& card : tirex::utils::amdgpu::listCards())
+		devices.emplace_back(card.name + '=' + card.pciAddress);
+#endif
+	return tirex::utils::join(devices, ',');
+}
+
 Stats GPUStats::getInfo() {
-	/** \todo: filter by requested metrics */
-	if (nvml.supported) {
+	return tirex::utils::infocache::get("gpu", [this]() { return collectInfo(); }, listVisibleDevices());
+}
+
+Stats GPUStats::collectInfo() {
+	init();
+	if (available()) {
 		std::string modelName;
 		std::string vramTotal;
 		std::string cores;
@@ -191,6 +864,17 @@ Stats GPUStats::getInfo() {
 				vramTotal += "<error>,";
 			}
 		}
+#if __linux__
+		namespace amdgpu = tirex::utils::amdgpu;
+		for (const auto& card : amd.cards) {
+			modelName += amdgpu::readName(card) + ",";
+			cores += "<unknown>,"; // amdgpu does not expose the number of shader cores
+			if (auto total = amdgpu::readVramTotal(card))
+				vramTotal += std::to_string(*total / 1000 / 1000) + ",";
+			else
+				vramTotal += "<error>,";
+		}
+#endif
 
 		return {{TIREX_GPU_SUPPORTED, "1"s},
 				{TIREX_GPU_MODEL_NAME, modelName},
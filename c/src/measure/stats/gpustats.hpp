@@ -4,22 +4,170 @@
 #include "../measure.hpp"
 #include "provider.hpp"
 
+#include <array>
+#include <bitset>
+#include <cstdint>
+#include <map>
+#include <optional>
+#include <vector>
+
+#if __linux__
+#include "../utils/amdgpu.hpp"
+
+#include <chrono>
+#endif
+
 using nvmlDevice_t = struct nvmlDevice_st*;
 
 namespace tirex {
+	/**
+	 * @brief Collects GPU related metrics of NVIDIA GPUs using NVML and, on Linux, of AMD GPUs using the sysfs
+	 * interface of the amdgpu driver.
+	 * @details The per-process metrics only account for the tracked processes and, on Linux, all of their children.
+	 * Every metric is collected per device and aggregated over all devices (utilizations are averaged and memory usage
+	 * is summed up).
+	 *
+	 * If `TIREX_GPU_SAMPLES_STEP_INTERVAL` is set to some N > 0, the devices are only queried every N-th polling step
+	 * and, instead of the current utilization, the samples that the driver buffered since the last query are fetched
+	 * (GPU and memory utilization and power draw). This yields series at the driver's resolution (e.g., every 1/6 s
+	 * for the utilization), even if the devices are queried only rarely.
+	 *
+	 * Metrics that a device does not support (or that fail for other reasons than transient errors) are no longer
+	 * queried for that device and are omitted if no device supports them.
+	 *
+	 * AMD GPUs are reported after the NVIDIA GPUs and labeled by the name of their DRM card (e.g., card1). Their
+	 * per-process metrics are read from the DRM client statistics in `/proc/<pid>/fdinfo` and their energy is
+	 * integrated from the power draw unless the card provides an energy counter. The sysfs root can be overridden by
+	 * setting `TIREX_SYSFS_ROOT`.
+	 */
 	class GPUStats final : public StatsProvider {
 	private:
+		/** The metrics that are queried for each device **/
+		enum Metric : size_t {
+			MemoryInfo,
+			Utilization,
+			Power,				 /**< Field, in milliwatts **/
+			Energy,				 /**< Field, in millijoules since the driver was loaded **/
+			MemoryTemperature,	 /**< Field, in °C **/
+			PowerThrottleTime,	 /**< Field, in nanoseconds the clocks were reduced due to the power policy **/
+			ThermalThrottleTime, /**< Field, in nanoseconds the clocks were reduced due to the thermal policy **/
+			SmClock,
+			MemoryClock,
+			Temperature,
+			PcieTx,
+			PcieRx,
+			ThrottleReasons,
+			NumMetrics
+		};
+		struct Device {
+			std::bitset<NumMetrics> unsupported;
+			std::array<std::optional<unsigned long long>, NumMetrics> startFields; /**< The fields at the start **/
+			std::array<std::optional<unsigned long long>, NumMetrics> lastFields;  /**< The fields at the last query **/
+			std::map<unsigned long long, size_t> throttleSteps; /**< How many steps each throttle reason was active **/
+		};
+
+		struct SampledSeries {
+			TimeSeriesMatrix<unsigned> samples; /**< All samples with one column per device **/
+			std::vector<unsigned> current;		/**< The most recent sample of each device **/
+			std::vector<unsigned long long> lastSeen; /**< The timestamp of the most recent sample of each device **/
+		};
+
 		struct {
-			const bool supported;
+			bool supported = false;
 			std::vector<nvmlDevice_t> devices;
 			TimeSeries<unsigned> vramUsageTotal{true};
 			TimeSeries<unsigned> vramUsageProcess{true};
 			TimeSeries<unsigned> utilizationTotal{true};
+			TimeSeries<unsigned> utilizationProcess{true};
+			TimeSeriesMatrix<unsigned> deviceVramUsageTotal{}; /**< One column per device **/
+			TimeSeriesMatrix<unsigned> deviceVramUsageProcess{};
+			TimeSeriesMatrix<unsigned> deviceUtilizationTotal{};
+			TimeSeriesMatrix<unsigned> deviceUtilizationProcess{};
+			/** The timestamp of the most recent process utilization sample of each device **/
+			std::vector<unsigned long long> lastProcessSample{};
+			/** Fetch the samples of the driver every n-th step (0 = query the current values at every step) **/
+			size_t sampleInterval = 0;
+			size_t numSteps = 0;
+			SampledSeries utilizationSamples{};
+			SampledSeries memoryUtilizationSamples{};
+			SampledSeries powerSamples{};
+			TimeSeriesMatrix<unsigned> smClock{}; /**< One column per device (as all of the following) in MHz **/
+			TimeSeriesMatrix<unsigned> memoryClock{};
+			TimeSeriesMatrix<unsigned> power{}; /**< In watts **/
+			TimeSeriesMatrix<unsigned> temperature{};
+			TimeSeriesMatrix<unsigned> memoryTemperature{};
+			TimeSeriesMatrix<unsigned> pcieTx{}; /**< In KB/s **/
+			TimeSeriesMatrix<unsigned> pcieRx{};
 		} nvml;
+#if __linux__
+		struct {
+			std::vector<tirex::utils::amdgpu::Card> cards;
+			/** The time the graphics engine was busy with each DRM client (by ID) of the tracked processes per card **/
+			std::vector<std::map<uint64_t, uint64_t>> lastGfxNs;
+			std::chrono::steady_clock::time_point lastUpdate;
+		} amd;
+#endif
+		/** The bookkeeping of each device (first the NVIDIA GPUs and then the AMD GPUs) **/
+		std::vector<Device> state;
+		std::vector<uint32_t> pids;
+		/** The metrics that are not queried since none of the measures that need them was requested **/
+		const std::bitset<NumMetrics> unrequested;
+		const bool processes; /**< Whether any of the per-process metrics was requested **/
+		/** Whether init() was called, which is deferred until the devices are needed **/
+		bool initialized = false;
+
+		/**
+		 * @brief Fetches the samples of the given type (nvmlSamplingType_t) that the driver buffered for each device
+		 * since the last call and appends them to the series.
+		 * @details Devices are sampled at different points in time, so each row of the series holds the new sample of
+		 * one device and the most recent ones of the others.
+		 * @param scale The factor by which the samples are multiplied before they are added (e.g., to convert units).
+		 * @return the average of the new samples of each device or its most recent sample if there are none.
+		 */
+		std::vector<unsigned> fetchSamples(unsigned samplingType, SampledSeries& series, double scale);
+		/**
+		 * @brief Checks the result (nvmlReturn_t) of querying the metric and marks the metric as unsupported by the
+		 * device unless the error is transient.
+		 * @return true if the query succeeded.
+		 */
+		bool check(size_t device, Metric metric, int result);
+		bool supported(size_t device, Metric metric) const {
+			return !state[device].unsupported[metric] && !unrequested[metric];
+		}
+		/** @brief Returns true if at least one device supports the metric. **/
+		bool anySupports(Metric metric) const;
+		static std::bitset<NumMetrics> getUnrequested(const TrackingConf& conf);
+		/**
+		 * @brief Fetches all fields that the device supports (Metric::Power to Metric::ThermalThrottleTime) with a
+		 * single call and stores them in Device::lastFields.
+		 */
+		void queryFields(size_t device);
+		/**
+		 * @brief Loads NVML and finds the NVIDIA and AMD GPUs unless this was already done.
+		 * @details This is deferred until tracking starts or the information is collected since it is costly and not
+		 * needed if the information was cached (see getInfo()).
+		 */
+		void init();
+		/** @brief Adds a column for a new device to all per-device series. **/
+		void addColumn(const std::string& label);
+		/** @brief Returns true if NVML could be loaded or there is at least one AMD GPU. **/
+		bool available() const;
+		/** @brief Collects the information returned by getInfo(), which is cached (see tirex::utils::infocache). **/
+		Stats collectInfo();
+#if __linux__
+		/** @brief Finds the AMD GPUs and checks which metrics they provide. **/
+		void initAMD();
+		/**
+		 * @brief Reads the power draw of the AMD GPUs and updates their energy consumption (in Device::lastFields).
+		 */
+		void updateAMDEnergy();
+#endif
 
 	public:
-		GPUStats();
+		explicit GPUStats(const TrackingConf& conf);
 
+		void start() override;
+		void stop() override;
 		void step() override;
 		Stats getStats() override;
 		Stats getInfo() override;
@@ -30,4 +178,4 @@ namespace tirex {
 	};
 } // namespace tirex
 
-#endif
\ No newline at end of file
+#endif
@@ -0,0 +1,120 @@
+#include "iostats.hpp"
+
+#include "../../logging.hpp"
+
+#include <string>
+
+#if __linux__
+#include <unistd.h>
+#endif
+
+using std::chrono::steady_clock;
+
+using tirex::IOStats;
+using tirex::Stats;
+
+const char* IOStats::version = nullptr;
+const std::set<tirexMeasure> IOStats::measures{
+		TIREX_IO_READ_PROCESS_BYTES,
+		TIREX_IO_WRITTEN_PROCESS_BYTES,
+		TIREX_IO_STORAGE_READ_PROCESS_BYTES,
+		TIREX_IO_STORAGE_WRITTEN_PROCESS_BYTES,
+		TIREX_IO_READ_CALLS_PROCESS,
+		TIREX_IO_WRITE_CALLS_PROCESS,
+		TIREX_IO_READ_RATE_PROCESS_KBPS,
+		TIREX_IO_WRITE_RATE_PROCESS_KBPS,
+		TIREX_IO_STORAGE_READ_RATE_PROCESS_KBPS,
+		TIREX_IO_STORAGE_WRITE_RATE_PROCESS_KBPS
+};
+
+#if __linux__
+namespace procfs = tirex::utils::procfs;
+
+/** @brief Returns `now - before` or 0 if the counter decreased (e.g., since a child left the process tree). */
+static uint64_t delta(uint64_t now, uint64_t before) { return (now > before) ? (now - before) : 0; }
+
+IOStats::IOStats(const TrackingConf& conf)
+		: pids(procfs::toPids(conf.pids)),
+		  rates(conf.requested(
+				  {TIREX_IO_READ_RATE_PROCESS_KBPS, TIREX_IO_WRITE_RATE_PROCESS_KBPS,
+				   TIREX_IO_STORAGE_READ_RATE_PROCESS_KBPS, TIREX_IO_STORAGE_WRITE_RATE_PROCESS_KBPS}
+		  )) {}
+
+procfs::IoStat IOStats::readTree() {
+	procfs::IoStat total{};
+	self = false;
+	for (auto process : procfs::listProcessTree(pids)) {
+		if (auto io = procfs::readIo(process); io)
+			total += *io;
+		self |= (process == getpid());
+	}
+	// The tracker itself reads lots of files in /proc, which should not be accounted to the tracked process. Once the
+	// monitoring thread exited, its statistics are merged into the process, so we keep the last known value.
+	if (monitorTid != 0 && self) {
+		if (auto io = procfs::readIo(getpid(), monitorTid); io)
+			monitorIo = *io;
+	}
+	total.rchar = delta(total.rchar, monitorIo.rchar);
+	total.wchar = delta(total.wchar, monitorIo.wchar);
+	total.syscr = delta(total.syscr, monitorIo.syscr);
+	total.syscw = delta(total.syscw, monitorIo.syscw);
+	total.readBytes = delta(total.readBytes, monitorIo.readBytes);
+	total.writeBytes = delta(total.writeBytes, monitorIo.writeBytes);
+	return total;
+}
+
+void IOStats::start() {
+	for (auto pid : pids) {
+		if (!procfs::readIo(pid))
+			tirex::log::warn("iostats", "Could not read the I/O statistics of process {}", pid);
+	}
+	startIo = lastIo = readTree();
+	lastStep = steady_clock::now();
+}
+void IOStats::stop() { lastIo = readTree(); }
+void IOStats::step() {
+	if (monitorTid == 0)
+		monitorTid = gettid();
+	if (!rates) {
+		// The totals only need the I/O of the monitoring thread to be up to date when it exits (see readTree())
+		if (auto io = self ? procfs::readIo(getpid(), monitorTid) : std::nullopt; io)
+			monitorIo = *io;
+		return;
+	}
+	auto io = readTree();
+	auto now = steady_clock::now();
+	auto elapsedMs = std::chrono::duration_cast<std::chrono::milliseconds>(now - lastStep).count();
+	if (elapsedMs > 0) {
+		// Bytes per millisecond times 1000 / 1024 is kilobytes per second
+		auto kbps = [elapsedMs](uint64_t now, uint64_t before) {
+			return static_cast<unsigned>(delta(now, before) * 1000 / 1024 / elapsedMs);
+		};
+		readRate.addValue(kbps(io.rchar, lastIo.rchar));
+		writeRate.addValue(kbps(io.wchar, lastIo.wchar));
+		storageReadRate.addValue(kbps(io.readBytes, lastIo.readBytes));
+		storageWriteRate.addValue(kbps(io.writeBytes, lastIo.writeBytes));
+	}
+	lastIo = io;
+	lastStep = now;
+}
+
+Stats IOStats::getStats() {
+	return {{TIREX_IO_READ_PROCESS_BYTES, std::to_string(delta(lastIo.rchar, startIo.rchar))},
+			{TIREX_IO_WRITTEN_PROCESS_BYTES, std::to_string(delta(lastIo.wchar, startIo.wchar))},
+			{TIREX_IO_STORAGE_READ_PROCESS_BYTES, std::to_string(delta(lastIo.readBytes, startIo.readBytes))},
+			{TIREX_IO_STORAGE_WRITTEN_PROCESS_BYTES, std::to_string(delta(lastIo.writeBytes, startIo.writeBytes))},
+			{TIREX_IO_READ_CALLS_PROCESS, std::to_string(delta(lastIo.syscr, startIo.syscr))},
+			{TIREX_IO_WRITE_CALLS_PROCESS, std::to_string(delta(lastIo.syscw, startIo.syscw))},
+			{TIREX_IO_READ_RATE_PROCESS_KBPS, readRate},
+			{TIREX_IO_WRITE_RATE_PROCESS_KBPS, writeRate},
+			{TIREX_IO_STORAGE_READ_RATE_PROCESS_KBPS, storageReadRate},
+			{TIREX_IO_STORAGE_WRITE_RATE_PROCESS_KBPS, storageWriteRate}};
+}
+#else
+IOStats::IOStats(const TrackingConf&) { tirex::log::warn("iostats", "I/O statistics are not supported on this platform"); }
+
+void IOStats::start() {}
+void IOStats::stop() {}
+void IOStats::step() {}
+Stats IOStats::getStats() { return {}; }
+#endif
\ No newline at end of file
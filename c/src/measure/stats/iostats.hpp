@@ -0,0 +1,61 @@
+#ifndef STATS_IOSTATS_HPP
+#define STATS_IOSTATS_HPP
+
+#include "../measure.hpp"
+#include "provider.hpp"
+
+#include <chrono>
+#include <vector>
+
+#if __linux__
+#include "../utils/procfs.hpp"
+
+#include <sys/types.h>
+#endif
+
+namespace tirex {
+	/**
+	 * @brief Collects the I/O statistics (bytes and system calls) of the tracked processes and all of their children.
+	 * @details Currently, only Linux is supported, where the statistics are read from `/proc/<pid>/io`.
+	 */
+	class IOStats final : public StatsProvider {
+	private:
+		tirex::TimeSeries<unsigned> readRate{true};
+		tirex::TimeSeries<unsigned> writeRate{true};
+		tirex::TimeSeries<unsigned> storageReadRate{true};
+		tirex::TimeSeries<unsigned> storageWriteRate{true};
+
+#if __linux__
+		std::vector<pid_t> pids;
+		/** Whether any of the rates was requested, only they need to read the process tree at every step **/
+		const bool rates;
+		bool self = false; /**< Whether the tracker's own process is part of the tracked process tree **/
+		pid_t monitorTid = 0; /**< The thread calling step(), whose reads should not be accounted to the process **/
+		tirex::utils::procfs::IoStat monitorIo{}; /**< The I/O of the monitoring thread at the last step **/
+		tirex::utils::procfs::IoStat startIo{};
+		tirex::utils::procfs::IoStat lastIo{};
+		std::chrono::steady_clock::time_point lastStep;
+
+		/**
+		 * @brief Sums up the I/O statistics of all processes of the tracked process tree.
+		 * @details Children that exited and were waited for are accounted to their parent by the kernel such that the
+		 * sum only grows over time, unless a child is orphaned and thus leaves the tree.
+		 */
+		tirex::utils::procfs::IoStat readTree();
+#endif
+
+	public:
+		explicit IOStats(const TrackingConf& conf);
+
+		void start() override;
+		void stop() override;
+		void step() override;
+		Stats getStats() override;
+
+		static constexpr const char* description = "Collects I/O metrics of the process.";
+		static const char* version;
+		static const std::set<tirexMeasure> measures;
+	};
+} // namespace tirex
+
+#endif
\ No newline at end of file
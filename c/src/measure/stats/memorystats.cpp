@@ -0,0 +1,95 @@
+#include "memorystats.hpp"
+
+#include "../../logging.hpp"
+#include "../utils/procfs.hpp"
+
+#include <string>
+
+#if __linux__
+#include <unistd.h>
+#endif
+
+using tirex::MemoryStats;
+using tirex::Stats;
+
+const char* MemoryStats::version = nullptr;
+const std::set<tirexMeasure> MemoryStats::measures{
+		TIREX_RAM_PSS_PROCESS_KB,
+		TIREX_RAM_USS_PROCESS_KB,
+		TIREX_RAM_ANON_PROCESS_KB,
+		TIREX_RAM_FILE_PROCESS_KB,
+		TIREX_RAM_SHMEM_PROCESS_KB,
+		TIREX_RAM_SWAP_PROCESS_KB,
+		TIREX_RAM_HUGEPAGES_PROCESS_KB
+};
+
+#if __linux__
+namespace procfs = tirex::utils::procfs;
+
+static uint64_t get(const std::map<std::string, uint64_t>& fields, const char* key) {
+	auto it = fields.find(key);
+	return (it != fields.end()) ? it->second : 0;
+}
+
+MemoryStats::MemoryStats(const TrackingConf& conf)
+		: pids(procfs::toPids(conf.pids)),
+		  rollup(conf.requested(
+				  {TIREX_RAM_PSS_PROCESS_KB, TIREX_RAM_USS_PROCESS_KB, TIREX_RAM_SWAP_PROCESS_KB,
+				   TIREX_RAM_HUGEPAGES_PROCESS_KB}
+		  )),
+		  status(conf.requested({TIREX_RAM_ANON_PROCESS_KB, TIREX_RAM_FILE_PROCESS_KB, TIREX_RAM_SHMEM_PROCESS_KB})) {}
+
+void MemoryStats::start() {
+	// smaps_rollup exists since Linux 4.14
+	if (rollup && !std::filesystem::exists(procfs::pidPath(pids.front()) / "smaps_rollup"))
+		tirex::log::warn("memorystats", "smaps_rollup is not available, so PSS, USS and swap are reported as 0");
+}
+
+void MemoryStats::step() {
+	if (!rollup && !status)
+		return;
+	uint64_t pssKB = 0, ussKB = 0, anonKB = 0, fileKB = 0, shmemKB = 0, swapKB = 0, hugePagesKB = 0;
+	for (auto process : procfs::listProcessTree(pids)) {
+		// Section 1.2 and Table 1-2 in https://www.kernel.org/doc/html/latest/filesystems/proc.html (values are in kB)
+		if (rollup) {
+			// The kernel walks the page tables of the process to compute smaps_rollup, so it is only read if needed
+			auto fields = procfs::readFields(procfs::pidPath(process) / "smaps_rollup");
+			pssKB += get(fields, "Pss");
+			ussKB += get(fields, "Private_Clean") + get(fields, "Private_Dirty");
+			swapKB += get(fields, "Swap");
+			hugePagesKB += get(fields, "AnonHugePages");
+		}
+		if (status) {
+			auto fields = procfs::readFields(procfs::pidPath(process) / "status");
+			anonKB += get(fields, "RssAnon");
+			fileKB += get(fields, "RssFile");
+			shmemKB += get(fields, "RssShmem");
+		}
+	}
+	pss.addValue(static_cast<unsigned>(pssKB));
+	uss.addValue(static_cast<unsigned>(ussKB));
+	anon.addValue(static_cast<unsigned>(anonKB));
+	file.addValue(static_cast<unsigned>(fileKB));
+	shmem.addValue(static_cast<unsigned>(shmemKB));
+	swap.addValue(static_cast<unsigned>(swapKB));
+	hugePages.addValue(static_cast<unsigned>(hugePagesKB));
+}
+
+Stats MemoryStats::getStats() {
+	return {{TIREX_RAM_PSS_PROCESS_KB, pss},
+			{TIREX_RAM_USS_PROCESS_KB, uss},
+			{TIREX_RAM_ANON_PROCESS_KB, anon},
+			{TIREX_RAM_FILE_PROCESS_KB, file},
+			{TIREX_RAM_SHMEM_PROCESS_KB, shmem},
+			{TIREX_RAM_SWAP_PROCESS_KB, swap},
+			{TIREX_RAM_HUGEPAGES_PROCESS_KB, hugePages}};
+}
+#else
+MemoryStats::MemoryStats(const TrackingConf&) {
+	tirex::log::warn("memorystats", "The detailed memory breakdown is not supported on this platform");
+}
+
+void MemoryStats::start() {}
+void MemoryStats::step() {}
+Stats MemoryStats::getStats() { return {}; }
+#endif
\ No newline at end of file
@@ -0,0 +1,50 @@
+#ifndef STATS_MEMORYSTATS_HPP
+#define STATS_MEMORYSTATS_HPP
+
+#include "../measure.hpp"
+#include "provider.hpp"
+
+#if __linux__
+#include <sys/types.h>
+#endif
+
+#include <vector>
+
+namespace tirex {
+	/**
+	 * @brief Collects a breakdown of the memory used by the tracked processes and all of their children (proportional and
+	 * unique set size, anonymous vs. file-backed memory, swap and huge pages).
+	 * @details Currently, only Linux is supported, where the statistics are read from `/proc/<pid>/smaps_rollup` and
+	 * `/proc/<pid>/status`. Note that reading `smaps_rollup` requires the kernel to walk the page tables of the
+	 * process, which is more expensive than reading the resident set size alone.
+	 */
+	class MemoryStats final : public StatsProvider {
+	private:
+		tirex::TimeSeries<unsigned> pss{true};
+		tirex::TimeSeries<unsigned> uss{true};
+		tirex::TimeSeries<unsigned> anon{true};
+		tirex::TimeSeries<unsigned> file{true};
+		tirex::TimeSeries<unsigned> shmem{true};
+		tirex::TimeSeries<unsigned> swap{true};
+		tirex::TimeSeries<unsigned> hugePages{true};
+
+#if __linux__
+		std::vector<pid_t> pids;
+		const bool rollup; /**< Whether any of the measures that are read from smaps_rollup was requested **/
+		const bool status; /**< Whether any of the measures that are read from status was requested **/
+#endif
+
+	public:
+		explicit MemoryStats(const TrackingConf& conf);
+
+		void start() override;
+		void step() override;
+		Stats getStats() override;
+
+		static constexpr const char* description = "Collects a detailed breakdown of the memory used by the process.";
+		static const char* version;
+		static const std::set<tirexMeasure> measures;
+	};
+} // namespace tirex
+
+#endif
\ No newline at end of file
@@ -0,0 +1,187 @@
+#include "pagecachestats.hpp"
+
+#include "../../logging.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <optional>
+#include <sstream>
+
+#if __linux__
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+using tirex::PageCacheStats;
+using tirex::Stats;
+
+const char* PageCacheStats::version = nullptr;
+const std::set<tirexMeasure> PageCacheStats::measures{
+		TIREX_PAGECACHE_START, TIREX_PAGECACHE_STOP, TIREX_PAGECACHE_RESIDENT_PERCENT, TIREX_PAGECACHE_STATE
+};
+
+#if __linux__
+/** cachestat(2) has the same number on all architectures but may not be known to older kernel headers **/
+static constexpr long cachestatSyscall = 451;
+struct CachestatRange {
+	uint64_t off;
+	uint64_t len; /**< 0 means "until the end of the file" **/
+};
+struct Cachestat {
+	uint64_t nrCache;
+	uint64_t nrDirty;
+	uint64_t nrWriteback;
+	uint64_t nrEvicted;
+	uint64_t nrRecentlyEvicted;
+};
+
+/**
+ * @brief Returns the number of pages of the file that are in the page cache or std::nullopt if it could not be queried.
+ */
+static std::optional<uint64_t> countResidentPages(int fd, uint64_t size) {
+	static std::atomic<bool> hasCachestat = true;
+	if (hasCachestat) {
+		CachestatRange range{.off = 0, .len = 0};
+		Cachestat cstat;
+		if (syscall(cachestatSyscall, fd, &range, &cstat, 0) == 0)
+			return cstat.nrCache;
+		if (errno == ENOSYS)
+			hasCachestat = false;
+	}
+	// Fall back to mincore, which only works on mapped memory. Mapping the file does not load it into the cache.
+	static const auto pageSize = static_cast<uint64_t>(sysconf(_SC_PAGESIZE));
+	static constexpr uint64_t chunkSize = uint64_t{1} << 30; // Map at most 1 GiB at a time
+	uint64_t resident = 0;
+	std::vector<unsigned char> pages;
+	for (uint64_t offset = 0; offset < size; offset += chunkSize) {
+		auto length = std::min(chunkSize, size - offset);
+		auto addr = mmap(nullptr, length, PROT_READ, MAP_SHARED, fd, static_cast<off_t>(offset));
+		if (addr == MAP_FAILED)
+			return std::nullopt;
+		pages.resize((length + pageSize - 1) / pageSize);
+		auto ok = mincore(addr, length, pages.data()) == 0;
+		munmap(addr, length);
+		if (!ok)
+			return std::nullopt;
+		for (auto page : pages)
+			resident += page & 1;
+	}
+	return resident;
+}
+
+PageCacheStats::PageCacheStats(const TrackingConf& conf)
+		: sampleStart(conf.requested({TIREX_PAGECACHE_START, TIREX_PAGECACHE_STATE})),
+		  sampleStop(conf.requested({TIREX_PAGECACHE_STOP})) {
+	if (auto env = std::getenv("TIREX_PAGECACHE_PATHS"); env != nullptr) {
+		std::istringstream is(env);
+		for (std::string path; std::getline(is, path, ':');) {
+			if (!path.empty())
+				paths.emplace_back(path);
+		}
+	}
+	if (auto env = std::getenv("TIREX_PAGECACHE_STEP_INTERVAL");
+		env != nullptr && conf.requested({TIREX_PAGECACHE_RESIDENT_PERCENT}))
+		stepInterval = std::strtoul(env, nullptr, 10);
+	if (paths.empty())
+		tirex::log::warn("pagecachestats", "No paths were configured, set TIREX_PAGECACHE_PATHS to track them");
+}
+
+PageCacheStats::Residency PageCacheStats::getResidency() const {
+	static const auto pageSize = static_cast<uint64_t>(sysconf(_SC_PAGESIZE));
+	Residency residency{};
+	auto addFile = [&residency](const std::filesystem::path& file) {
+		auto fd = open(file.c_str(), O_RDONLY | O_CLOEXEC);
+		if (fd < 0) {
+			tirex::log::debug("pagecachestats", "Could not open {}: {}", file.string(), std::strerror(errno));
+			return;
+		}
+		struct stat st;
+		if (fstat(fd, &st) == 0 && S_ISREG(st.st_mode) && st.st_size > 0) {
+			auto size = static_cast<uint64_t>(st.st_size);
+			if (auto resident = countResidentPages(fd, size); resident) {
+				++residency.files;
+				residency.totalPages += (size + pageSize - 1) / pageSize;
+				residency.residentPages += *resident;
+			} else {
+				tirex::log::debug("pagecachestats", "Could not query {}: {}", file.string(), std::strerror(errno));
+			}
+		}
+		close(fd);
+	};
+	for (const auto& path : paths) {
+		std::error_code ec;
+		if (std::filesystem::is_directory(path, ec)) {
+			auto options = std::filesystem::directory_options::skip_permission_denied;
+			for (std::filesystem::recursive_directory_iterator it(path, options, ec), end; !ec && it != end;
+				 it.increment(ec)) {
+				if (it->is_regular_file(ec))
+					addFile(it->path());
+			}
+		} else if (std::filesystem::exists(path, ec)) {
+			addFile(path);
+		} else {
+			tirex::log::warn("pagecachestats", "The path {} does not exist", path.string());
+		}
+	}
+	return residency;
+}
+
+void PageCacheStats::start() {
+	if (paths.empty() || !sampleStart)
+		return;
+	startResidency = getResidency();
+	tirex::log::info(
+			"pagecachestats", "{:.2f}% of {} files are in the page cache", startResidency.percent(),
+			startResidency.files
+	);
+}
+void PageCacheStats::stop() {
+	if (!paths.empty() && sampleStop)
+		stopResidency = getResidency();
+}
+void PageCacheStats::step() {
+	if (paths.empty() || stepInterval == 0 || (++numSteps % stepInterval) != 0)
+		return;
+	resident.addValue(static_cast<unsigned>(std::lround(getResidency().percent())));
+}
+
+Stats PageCacheStats::getStats() {
+	if (paths.empty())
+		return {};
+	static const auto pageSize = static_cast<uint64_t>(sysconf(_SC_PAGESIZE));
+	auto toYAML = [](const Residency& residency) {
+		return _fmt::format(
+				"{{files: {}, total_mb: {}, resident_mb: {}, resident_percent: {:.2f}}}", residency.files,
+				residency.totalPages * pageSize / 1000 / 1000, residency.residentPages * pageSize / 1000 / 1000,
+				residency.percent()
+		);
+	};
+	auto percent = startResidency.percent();
+	std::string state = (percent >= warmThreshold) ? "warm" : (percent <= coldThreshold) ? "cold" : "partial";
+	Stats stats{
+			{TIREX_PAGECACHE_START, toYAML(startResidency)},
+			{TIREX_PAGECACHE_STOP, toYAML(stopResidency)},
+			{TIREX_PAGECACHE_STATE, state}
+	};
+	if (stepInterval != 0)
+		stats.insert({TIREX_PAGECACHE_RESIDENT_PERCENT, resident});
+	return stats;
+}
+#else
+PageCacheStats::PageCacheStats(const TrackingConf&) : sampleStart(false), sampleStop(false) {
+	tirex::log::warn("pagecachestats", "Page cache residency is not supported on this platform");
+}
+
+PageCacheStats::Residency PageCacheStats::getResidency() const { return {}; }
+void PageCacheStats::start() {}
+void PageCacheStats::stop() {}
+void PageCacheStats::step() {}
+Stats PageCacheStats::getStats() { return {}; }
+#endif
\ No newline at end of file
@@ -0,0 +1,66 @@
+#ifndef STATS_PAGECACHESTATS_HPP
+#define STATS_PAGECACHESTATS_HPP
+
+#include "../measure.hpp"
+#include "provider.hpp"
+
+#include <cstdint>
+#include <filesystem>
+#include <string>
+#include <vector>
+
+namespace tirex {
+	/**
+	 * @brief Collects how much of a set of declared input files (e.g., an index) is resident in the page cache.
+	 * @details The paths are read from the `TIREX_PAGECACHE_PATHS` environment variable (separated by colons like
+	 * `PATH`). Directories are traversed recursively. The residency is sampled when tracking starts and stops and, if
+	 * `TIREX_PAGECACHE_STEP_INTERVAL` is set to some N > 0, every N-th polling step, each only if a measure needs it.
+	 *
+	 * Currently, only Linux is supported, where the residency is queried using `cachestat` (Linux 6.5 and newer) or
+	 * `mmap` and `mincore` otherwise. Neither of them reads the files or changes the state of the page cache.
+	 */
+	class PageCacheStats final : public StatsProvider {
+	public:
+		struct Residency {
+			size_t files;		   /**< The number of regular files that were found **/
+			uint64_t totalPages;   /**< The size of all files in pages **/
+			uint64_t residentPages; /**< The number of pages that are currently cached **/
+
+			double percent() const noexcept {
+				return (totalPages != 0) ? static_cast<double>(residentPages) * 100 / totalPages : 0.0;
+			}
+		};
+
+	private:
+		std::vector<std::filesystem::path> paths;
+		size_t stepInterval = 0; /**< Sample the residency every n-th step (0 = only at start and stop) **/
+		size_t numSteps = 0;
+		const bool sampleStart; /**< Whether the residency at the start (or the state derived from it) was requested **/
+		const bool sampleStop;
+		Residency startResidency{};
+		Residency stopResidency{};
+		tirex::TimeSeries<unsigned> resident{true};
+
+		/**
+		 * @brief The cache is considered to be warm (or cold) if at least (at most) this percentage of pages is cached.
+		 */
+		static constexpr double warmThreshold = 90;
+		static constexpr double coldThreshold = 10;
+
+		Residency getResidency() const;
+
+	public:
+		explicit PageCacheStats(const TrackingConf& conf);
+
+		void start() override;
+		void stop() override;
+		void step() override;
+		Stats getStats() override;
+
+		static constexpr const char* description = "Collects the page cache residency of declared input files.";
+		static const char* version;
+		static const std::set<tirexMeasure> measures;
+	};
+} // namespace tirex
+
+#endif
\ No newline at end of file
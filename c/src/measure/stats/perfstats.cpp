@@ -0,0 +1,224 @@
+#include "perfstats.hpp"
+
+#include "../../logging.hpp"
+#include "../utils/procfs.hpp"
+
+#include <cerrno>
+#include <cstring>
+#include <string>
+
+#if __linux__
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+using tirex::PerfStats;
+using tirex::Stats;
+
+const char* PerfStats::version = nullptr;
+const std::set<tirexMeasure> PerfStats::measures{
+		TIREX_PERF_CYCLES,
+		TIREX_PERF_INSTRUCTIONS,
+		TIREX_PERF_CACHE_REFERENCES,
+		TIREX_PERF_CACHE_MISSES,
+		TIREX_PERF_BRANCH_MISSES,
+		TIREX_PERF_CONTEXT_SWITCHES,
+		TIREX_PERF_CPU_MIGRATIONS,
+		TIREX_PERF_PAGE_FAULTS,
+		TIREX_PERF_IPC,
+		TIREX_PERF_CACHE_MISS_PERCENT
+};
+
+#if __linux__
+namespace procfs = tirex::utils::procfs;
+
+const PerfStats::Event PerfStats::events[] = {
+		// Cycles and instructions are grouped such that the IPC is computed over the same period of time
+		{TIREX_PERF_CYCLES, PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES, true},
+		{TIREX_PERF_INSTRUCTIONS, PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS, false},
+		// Likewise for the cache miss rate
+		{TIREX_PERF_CACHE_REFERENCES, PERF_TYPE_HARDWARE, PERF_COUNT_HW_CACHE_REFERENCES, true},
+		{TIREX_PERF_CACHE_MISSES, PERF_TYPE_HARDWARE, PERF_COUNT_HW_CACHE_MISSES, false},
+		{TIREX_PERF_BRANCH_MISSES, PERF_TYPE_HARDWARE, PERF_COUNT_HW_BRANCH_MISSES, false},
+		// Software events are counted by the kernel and are always available
+		{TIREX_PERF_CONTEXT_SWITCHES, PERF_TYPE_SOFTWARE, PERF_COUNT_SW_CONTEXT_SWITCHES, true},
+		{TIREX_PERF_CPU_MIGRATIONS, PERF_TYPE_SOFTWARE, PERF_COUNT_SW_CPU_MIGRATIONS, false},
+		{TIREX_PERF_PAGE_FAULTS, PERF_TYPE_SOFTWARE, PERF_COUNT_SW_PAGE_FAULTS, false},
+};
+
+PerfStats::PerfStats(const TrackingConf& conf) : pids(procfs::toPids(conf.pids)), requested(getRequested(conf)) {}
+
+std::bitset<PerfStats::numEvents> PerfStats::getRequested(const TrackingConf& conf) {
+	auto needed = [&conf](tirexMeasure measure) {
+		switch (measure) {
+		case TIREX_PERF_CYCLES:
+		case TIREX_PERF_INSTRUCTIONS:
+			return conf.requested({measure, TIREX_PERF_IPC});
+		case TIREX_PERF_CACHE_REFERENCES:
+		case TIREX_PERF_CACHE_MISSES:
+			return conf.requested({measure, TIREX_PERF_CACHE_MISS_PERCENT});
+		default:
+			return conf.requested({measure});
+		}
+	};
+	std::bitset<numEvents> requested;
+	for (size_t begin = 0, end; begin < numEvents; begin = end) {
+		// The members of a group can only be counted together with their leader, so groups are counted as a whole
+		bool any = needed(events[begin].measure);
+		for (end = begin + 1; end < numEvents && !events[end].leader; ++end)
+			any = any || needed(events[end].measure);
+		for (size_t i = begin; any && i < end; ++i)
+			requested.set(i);
+	}
+	return requested;
+}
+
+PerfStats::~PerfStats() {
+	for (const auto& counter : counters)
+		close(counter.fd);
+}
+
+int PerfStats::openCounter(const Event& event, pid_t tid, int groupFd) {
+	perf_event_attr attr{};
+	attr.size = sizeof(attr);
+	attr.type = event.type;
+	attr.config = event.config;
+	attr.disabled = event.leader ? 1 : 0; // Members are enabled and disabled together with their group leader
+	attr.inherit = 1;					  // Also count threads and processes that are spawned later on
+	attr.exclude_hv = 1;
+	attr.exclude_kernel = excludeKernel ? 1 : 0;
+	// PERF_FORMAT_GROUP can not be combined with inherit, so each counter of the group is read on its own
+	attr.read_format = PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+	return static_cast<int>(syscall(SYS_perf_event_open, &attr, tid, -1, groupFd, PERF_FLAG_FD_CLOEXEC));
+}
+
+void PerfStats::openCounters(pid_t tid) {
+	int leaderFd = -1;
+	for (size_t i = 0; i < numEvents; ++i) {
+		const auto& event = events[i];
+		if (!requested[i])
+			continue;
+		if (!event.leader && leaderFd < 0)
+			continue; // The group could not be opened
+		if (event.type == PERF_TYPE_HARDWARE && !hardware) {
+			leaderFd = -1;
+			continue;
+		}
+		auto fd = openCounter(event, tid, event.leader ? -1 : leaderFd);
+		if (fd < 0 && (errno == EACCES || errno == EPERM) && !excludeKernel) {
+			tirex::log::info(
+					"perfstats", "Not permitted to count kernel events (see /proc/sys/kernel/perf_event_paranoid), "
+								 "only user space is counted"
+			);
+			excludeKernel = true;
+			fd = openCounter(event, tid, event.leader ? -1 : leaderFd);
+		}
+		if (fd < 0) {
+			if (errno == ESRCH)
+				return; // The thread exited in the meantime
+			if (event.type == PERF_TYPE_HARDWARE && event.leader) {
+				tirex::log::warn(
+						"perfstats", "Hardware performance counters are not available ({}), falling back to software "
+									 "counters",
+						std::strerror(errno)
+				);
+				hardware = false;
+			} else {
+				tirex::log::warn(
+						"perfstats", "Failed to open the counter for measure {}: {}", static_cast<int>(event.measure),
+						std::strerror(errno)
+				);
+			}
+			if (event.leader)
+				leaderFd = -1;
+			continue;
+		}
+		if (event.leader)
+			leaderFd = fd;
+		counters.emplace_back(Counter{.event = i, .fd = fd});
+	}
+}
+
+void PerfStats::start() {
+	if (requested.none())
+		return;
+	// Counters are inherited only by threads and processes that are created after they were opened, so every thread
+	// that already exists is counted individually. Note that the tracker's own monitoring thread is spawned afterwards
+	// and is thus counted as well, which only adds a negligible overhead since it is idle most of the time.
+	size_t threads = 0;
+	for (auto process : procfs::listProcessTree(pids)) {
+		for (auto tid : procfs::listTasks(process)) {
+			openCounters(tid);
+			++threads;
+		}
+	}
+	for (const auto& counter : counters) {
+		if (events[counter.event].leader)
+			ioctl(counter.fd, PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP);
+	}
+	tirex::log::info("perfstats", "Opened {} performance counters for {} threads", counters.size(), threads);
+}
+
+void PerfStats::stop() {
+	for (const auto& counter : counters) {
+		if (events[counter.event].leader)
+			ioctl(counter.fd, PERF_EVENT_IOC_DISABLE, PERF_IOC_FLAG_GROUP);
+	}
+	values.assign(numEvents, std::nullopt);
+	for (const auto& counter : counters) {
+		struct {
+			uint64_t value;
+			uint64_t timeEnabled;
+			uint64_t timeRunning;
+		} data;
+		if (read(counter.fd, &data, sizeof(data)) != sizeof(data)) {
+			auto measure = static_cast<int>(events[counter.event].measure);
+			tirex::log::warn("perfstats", "Failed to read the counter for measure {}", measure);
+			continue;
+		}
+		// If there were more counters than the PMU could handle at once, the kernel multiplexes them and we extrapolate
+		// the value for the full period.
+		double value = 0;
+		if (data.timeRunning != 0) {
+			value = static_cast<double>(data.value) * data.timeEnabled / data.timeRunning;
+			if (data.timeRunning < data.timeEnabled)
+				tirex::log::debug(
+						"perfstats", "The counter for measure {} was only active {:.1f}% of the time and was scaled",
+						static_cast<int>(events[counter.event].measure), data.timeRunning * 100.0 / data.timeEnabled
+				);
+		}
+		values[counter.event] = values[counter.event].value_or(0) + value;
+	}
+}
+
+Stats PerfStats::getStats() {
+	Stats stats;
+	std::optional<double> byMeasure[TIREX_MEASURE_COUNT];
+	for (size_t i = 0; i < values.size(); ++i) {
+		if (values[i]) {
+			byMeasure[events[i].measure] = values[i];
+			stats.insert({events[i].measure, _fmt::format("{:.0f}", *values[i])});
+		}
+	}
+	const auto& cycles = byMeasure[TIREX_PERF_CYCLES];
+	const auto& instructions = byMeasure[TIREX_PERF_INSTRUCTIONS];
+	if (cycles && instructions && *cycles > 0)
+		stats.insert({TIREX_PERF_IPC, _fmt::format("{:.2f}", *instructions / *cycles)});
+	const auto& references = byMeasure[TIREX_PERF_CACHE_REFERENCES];
+	const auto& misses = byMeasure[TIREX_PERF_CACHE_MISSES];
+	if (references && misses && *references > 0)
+		stats.insert({TIREX_PERF_CACHE_MISS_PERCENT, _fmt::format("{:.2f}", *misses * 100 / *references)});
+	return stats;
+}
+#else
+PerfStats::PerfStats(const TrackingConf&) {
+	tirex::log::warn("perfstats", "Performance counters are not supported on this platform");
+}
+PerfStats::~PerfStats() = default;
+
+void PerfStats::start() {}
+void PerfStats::stop() {}
+Stats PerfStats::getStats() { return {}; }
+#endif
\ No newline at end of file
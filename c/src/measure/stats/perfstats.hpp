@@ -0,0 +1,75 @@
+#ifndef STATS_PERFSTATS_HPP
+#define STATS_PERFSTATS_HPP
+
+#include "provider.hpp"
+
+#include <bitset>
+#include <cstdint>
+#include <optional>
+#include <vector>
+
+#if __linux__
+#include <sys/types.h>
+#endif
+
+namespace tirex {
+	/**
+	 * @brief Collects hardware and software performance counters (cycles, instructions, cache misses, ...) of the
+	 * tracked processes and all of their children.
+	 * @details Currently, only Linux is supported, where the counters are read using `perf_event_open`. Counters that
+	 * should be compared with each other (e.g., cycles and instructions for the IPC) are scheduled as one group such
+	 * that they are always measured over the same period of time. If the kernel has to multiplex the counters, the
+	 * values are extrapolated using the time that each counter was enabled and running. If no hardware PMU is
+	 * available (e.g., inside many virtual machines), only the software counters are collected.
+	 */
+	class PerfStats final : public StatsProvider {
+	private:
+#if __linux__
+		/**
+		 * @brief A counter that is opened for a single thread of the tracked process.
+		 */
+		struct Counter {
+			size_t event; /**< The index of the counted event in PerfStats::events **/
+			int fd;
+		};
+		struct Event {
+			tirexMeasure measure;
+			uint32_t type;
+			uint64_t config;
+			bool leader; /**< If true, the event starts a new group, else it joins the group of the previous event **/
+		};
+		static constexpr size_t numEvents = 8;
+		static const Event events[numEvents];
+
+		std::vector<pid_t> pids;
+		/** The events that are counted, each group is counted if any of its events was requested **/
+		const std::bitset<numEvents> requested;
+		bool excludeKernel = false; /**< Set if the user is not allowed to count kernel events (perf_event_paranoid) **/
+		bool hardware = true;		/**< Cleared if the hardware counters are not supported **/
+		std::vector<Counter> counters;
+		std::vector<std::optional<double>> values; /**< The (scaled) value of each event after tracking stopped **/
+
+		/**
+		 * @brief Opens all counters for the given thread. Children that are spawned by the thread afterwards are
+		 * counted as well.
+		 */
+		void openCounters(pid_t tid);
+		int openCounter(const Event& event, pid_t tid, int groupFd);
+		static std::bitset<numEvents> getRequested(const TrackingConf& conf);
+#endif
+
+	public:
+		explicit PerfStats(const TrackingConf& conf);
+		~PerfStats();
+
+		void start() override;
+		void stop() override;
+		Stats getStats() override;
+
+		static constexpr const char* description = "Collects hardware and software performance counters.";
+		static const char* version;
+		static const std::set<tirexMeasure> measures;
+	};
+} // namespace tirex
+
+#endif
\ No newline at end of file
@@ -0,0 +1,187 @@
+#include "pressurestats.hpp"
+
+#include "../../logging.hpp"
+#include "../utils/procfs.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <fstream>
+#include <sstream>
+#include <string>
+
+#if __linux__
+#include <unistd.h>
+#endif
+
+using tirex::PressureStats;
+using tirex::Stats;
+
+const char* PressureStats::version = nullptr;
+const std::set<tirexMeasure> PressureStats::measures{
+		TIREX_PSI_CPU_SOME_PERMYRIAD,
+		TIREX_PSI_CPU_FULL_PERMYRIAD,
+		TIREX_PSI_MEMORY_SOME_PERMYRIAD,
+		TIREX_PSI_MEMORY_FULL_PERMYRIAD,
+		TIREX_PSI_IO_SOME_PERMYRIAD,
+		TIREX_PSI_IO_FULL_PERMYRIAD,
+		TIREX_PSI_CPU_SOME_STALL_MS,
+		TIREX_PSI_CPU_FULL_STALL_MS,
+		TIREX_PSI_MEMORY_SOME_STALL_MS,
+		TIREX_PSI_MEMORY_FULL_STALL_MS,
+		TIREX_PSI_IO_SOME_STALL_MS,
+		TIREX_PSI_IO_FULL_STALL_MS,
+		TIREX_PSI_CPU_SOME_AVG10_PERMYRIAD,
+		TIREX_PSI_CPU_FULL_AVG10_PERMYRIAD,
+		TIREX_PSI_MEMORY_SOME_AVG10_PERMYRIAD,
+		TIREX_PSI_MEMORY_FULL_AVG10_PERMYRIAD,
+		TIREX_PSI_IO_SOME_AVG10_PERMYRIAD,
+		TIREX_PSI_IO_FULL_AVG10_PERMYRIAD
+};
+
+#if __linux__
+namespace procfs = tirex::utils::procfs;
+
+/**
+ * @brief Parses a line of a pressure file, which looks like `some avg10=0.00 avg60=0.00 avg300=0.00 total=0`.
+ * @param avg10 Receives the running average of the last 10 seconds in hundredths of a percent.
+ * @param total Receives the total stall time in microseconds.
+ */
+static void parsePressureLine(const std::string& line, std::optional<unsigned>& avg10, std::optional<uint64_t>& total) {
+	std::istringstream fields(line);
+	std::string field;
+	fields >> field; // "some" or "full"
+	while (fields >> field) {
+		if (field.starts_with("avg10="))
+			avg10 = static_cast<unsigned>(std::lround(std::stod(field.substr(6)) * 100));
+		else if (field.starts_with("total="))
+			total = std::stoull(field.substr(6));
+	}
+}
+
+void PressureStats::Resource::update() {
+	lastSome = lastFull = std::nullopt;
+	std::ifstream is(file);
+	for (std::string line; std::getline(is, line);) {
+		std::optional<unsigned> avg10;
+		std::optional<uint64_t> total;
+		parsePressureLine(line, avg10, total);
+		if (!avg10 || !total)
+			continue;
+		if (line.starts_with("some"))
+			lastSome = Stall{.avg10 = *avg10, .total = *total};
+		else if (line.starts_with("full"))
+			lastFull = Stall{.avg10 = *avg10, .total = *total};
+	}
+}
+
+PressureStats::PressureStats(const TrackingConf& conf) {
+	std::filesystem::path dir = "/proc/pressure";
+	std::string suffix;
+	std::error_code ec;
+	// If multiple processes are tracked, they are assumed to share the cgroup of the first one
+	auto pid = procfs::toPids(conf.pids).front();
+	if (auto cgroup = procfs::cgroupPath(pid); cgroup && std::filesystem::exists(*cgroup / "cpu.pressure", ec)) {
+		dir = *cgroup;
+		suffix = ".pressure";
+	}
+	resources.emplace_back(
+			dir / ("cpu" + suffix), TIREX_PSI_CPU_SOME_PERMYRIAD, TIREX_PSI_CPU_FULL_PERMYRIAD,
+			TIREX_PSI_CPU_SOME_STALL_MS, TIREX_PSI_CPU_FULL_STALL_MS, TIREX_PSI_CPU_SOME_AVG10_PERMYRIAD,
+			TIREX_PSI_CPU_FULL_AVG10_PERMYRIAD
+	);
+	resources.emplace_back(
+			dir / ("memory" + suffix), TIREX_PSI_MEMORY_SOME_PERMYRIAD, TIREX_PSI_MEMORY_FULL_PERMYRIAD,
+			TIREX_PSI_MEMORY_SOME_STALL_MS, TIREX_PSI_MEMORY_FULL_STALL_MS, TIREX_PSI_MEMORY_SOME_AVG10_PERMYRIAD,
+			TIREX_PSI_MEMORY_FULL_AVG10_PERMYRIAD
+	);
+	resources.emplace_back(
+			dir / ("io" + suffix), TIREX_PSI_IO_SOME_PERMYRIAD, TIREX_PSI_IO_FULL_PERMYRIAD, TIREX_PSI_IO_SOME_STALL_MS,
+			TIREX_PSI_IO_FULL_STALL_MS, TIREX_PSI_IO_SOME_AVG10_PERMYRIAD, TIREX_PSI_IO_FULL_AVG10_PERMYRIAD
+	);
+	for (auto& resource : resources) {
+		resource.sampled = conf.requested(
+				{resource.someSeries, resource.fullSeries, resource.someAvg10Series, resource.fullAvg10Series}
+		);
+		resource.requested = resource.sampled || conf.requested({resource.someTotal, resource.fullTotal});
+	}
+}
+
+void PressureStats::start() {
+	for (auto& resource : resources) {
+		if (!resource.requested)
+			continue;
+		resource.update();
+		resource.startSome = resource.lastSome;
+		resource.startFull = resource.lastFull;
+		auto file = resource.file.string();
+		if (!resource.startSome) // The kernel was compiled without CONFIG_PSI or it was disabled with psi=0
+			tirex::log::warn("pressurestats", "Pressure stall information is not available at {}", file);
+		else
+			tirex::log::info("pressurestats", "Reading pressure stall information from {}", file);
+	}
+	lastStep = std::chrono::steady_clock::now();
+}
+void PressureStats::stop() {
+	for (auto& resource : resources) {
+		if (resource.requested)
+			resource.update();
+	}
+}
+void PressureStats::step() {
+	auto now = std::chrono::steady_clock::now();
+	auto elapsedUs = std::chrono::duration_cast<std::chrono::microseconds>(now - lastStep).count();
+	lastStep = now;
+	// The share of the step (in hundredths of a percent) in which tasks were stalled
+	auto share = [elapsedUs](const std::optional<Stall>& previous, const std::optional<Stall>& current) {
+		if (!previous || elapsedUs <= 0 || current->total < previous->total)
+			return 0u;
+		auto stalledUs = current->total - previous->total;
+		return static_cast<unsigned>(std::min<uint64_t>(stalledUs * 10000 / elapsedUs, 10000));
+	};
+	for (auto& resource : resources) {
+		if (!resource.sampled)
+			continue;
+		auto previousSome = resource.lastSome;
+		auto previousFull = resource.lastFull;
+		resource.update();
+		if (resource.lastSome) {
+			resource.some.addValue(share(previousSome, resource.lastSome));
+			resource.someAvg10.addValue(resource.lastSome->avg10);
+		}
+		if (resource.lastFull) {
+			resource.full.addValue(share(previousFull, resource.lastFull));
+			resource.fullAvg10.addValue(resource.lastFull->avg10);
+		}
+	}
+}
+
+Stats PressureStats::getStats() {
+	Stats stats;
+	auto stallMs = [](const std::optional<Stall>& start, const std::optional<Stall>& last) {
+		return std::to_string((last->total > start->total) ? (last->total - start->total) / 1000 : 0);
+	};
+	for (const auto& resource : resources) {
+		// Kernels before 5.13 do not report the "full" line for the CPU
+		if (resource.startSome && resource.lastSome) {
+			stats.insert({resource.someSeries, resource.some});
+			stats.insert({resource.someAvg10Series, resource.someAvg10});
+			stats.insert({resource.someTotal, stallMs(resource.startSome, resource.lastSome)});
+		}
+		if (resource.startFull && resource.lastFull) {
+			stats.insert({resource.fullSeries, resource.full});
+			stats.insert({resource.fullAvg10Series, resource.fullAvg10});
+			stats.insert({resource.fullTotal, stallMs(resource.startFull, resource.lastFull)});
+		}
+	}
+	return stats;
+}
+#else
+PressureStats::PressureStats(const TrackingConf&) {
+	tirex::log::warn("pressurestats", "Pressure stall information is not supported on this platform");
+}
+
+void PressureStats::start() {}
+void PressureStats::stop() {}
+void PressureStats::step() {}
+Stats PressureStats::getStats() { return {}; }
+#endif
\ No newline at end of file
@@ -0,0 +1,78 @@
+#ifndef STATS_PRESSURESTATS_HPP
+#define STATS_PRESSURESTATS_HPP
+
+#include "../measure.hpp"
+#include "provider.hpp"
+
+#include <chrono>
+#include <cstdint>
+#include <filesystem>
+#include <optional>
+#include <vector>
+
+namespace tirex {
+	/**
+	 * @brief Collects the Pressure Stall Information (PSI) for CPU, memory and I/O, i.e., how much time tasks were
+	 * stalled since they had to wait for the resource.
+	 * @details The series hold the share of each step in which tasks were stalled, which is computed from the total
+	 * stall time, and the kernel's running average over the last 10 seconds (avg10) at each step. Both are given in
+	 * hundredths of a percent (permyriad).
+	 *
+	 * Currently, only Linux is supported. If the (first) tracked process is part of a (v2) cgroup, the
+	 * cgroup's `*.pressure` files are read, which only account for the tasks of that cgroup. Otherwise, the
+	 * system-wide statistics from `/proc/pressure/` are used. See https://docs.kernel.org/accounting/psi.html
+	 */
+	class PressureStats final : public StatsProvider {
+	private:
+#if __linux__
+		/**
+		 * @brief A single line of a pressure file.
+		 */
+		struct Stall {
+			unsigned avg10; /**< The running average of the last 10 seconds in hundredths of a percent **/
+			uint64_t total; /**< Total stall time in microseconds **/
+		};
+		struct Resource {
+			std::filesystem::path file;
+			tirexMeasure someSeries, fullSeries, someTotal, fullTotal, someAvg10Series, fullAvg10Series;
+			bool requested = true; /**< Whether any of the measures of the resource was requested **/
+			bool sampled = true;   /**< Whether any of the series was requested, which are updated at every step **/
+			tirex::TimeSeries<unsigned> some{true}; /**< In hundredths of a percent of each step **/
+			tirex::TimeSeries<unsigned> full{true};
+			tirex::TimeSeries<unsigned> someAvg10{true}; /**< The kernel's avg10 at each step **/
+			tirex::TimeSeries<unsigned> fullAvg10{true};
+			std::optional<Stall> startSome, startFull; /**< The stall times when tracking started **/
+			std::optional<Stall> lastSome, lastFull;   /**< The stall times of the last sample **/
+
+			Resource(
+					std::filesystem::path file, tirexMeasure someSeries, tirexMeasure fullSeries,
+					tirexMeasure someTotal, tirexMeasure fullTotal, tirexMeasure someAvg10Series,
+					tirexMeasure fullAvg10Series
+			)
+					: file(std::move(file)), someSeries(someSeries), fullSeries(fullSeries), someTotal(someTotal),
+					  fullTotal(fullTotal), someAvg10Series(someAvg10Series), fullAvg10Series(fullAvg10Series) {}
+
+			/**
+			 * @brief Reads the current pressure into lastSome and lastFull.
+			 */
+			void update();
+		};
+		std::vector<Resource> resources;
+		std::chrono::steady_clock::time_point lastStep;
+#endif
+
+	public:
+		explicit PressureStats(const TrackingConf& conf);
+
+		void start() override;
+		void stop() override;
+		void step() override;
+		Stats getStats() override;
+
+		static constexpr const char* description = "Collects pressure stall metrics for CPU, memory and I/O.";
+		static const char* version;
+		static const std::set<tirexMeasure> measures;
+	};
+} // namespace tirex
+
+#endif
\ No newline at end of file
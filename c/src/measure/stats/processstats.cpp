@@ -0,0 +1,266 @@
+#include "processstats.hpp"
+
+#include "../../logging.hpp"
+#include "../utils/procfs.hpp"
+#include "../utils/rangeutils.hpp"
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+
+#if __linux__
+#include <linux/cn_proc.h>
+#include <linux/connector.h>
+#include <linux/netlink.h>
+#include <poll.h>
+#include <sys/socket.h>
+#include <time.h>
+#include <unistd.h>
+#endif
+
+using tirex::ProcessStats;
+using tirex::Stats;
+
+const char* ProcessStats::version = nullptr;
+const std::set<tirexMeasure> ProcessStats::measures{TIREX_PROCESS_TIMELINE, TIREX_PROCESS_COUNT};
+
+#if __linux__
+namespace procfs = tirex::utils::procfs;
+
+static int64_t clockMs(clockid_t clock) {
+	timespec ts;
+	clock_gettime(clock, &ts);
+	return static_cast<int64_t>(ts.tv_sec) * 1000 + ts.tv_nsec / 1000000;
+}
+
+/**
+ * @brief Converts a wait status into the exit code a shell would report (128 + n if killed by signal n).
+ */
+static int toExitCode(uint32_t status) {
+	if ((status & 0x7f) != 0)
+		return 128 + static_cast<int>(status & 0x7f);
+	return static_cast<int>((status >> 8) & 0xff);
+}
+
+/**
+ * @brief Quotes the string such that it can be used as a double-quoted YAML scalar.
+ */
+static std::string quote(const std::string& str) {
+	std::string quoted = "\"";
+	for (auto c : str) {
+		if (c == '"' || c == '\\')
+			quoted += '\\';
+		quoted += (static_cast<unsigned char>(c) < 0x20) ? ' ' : c;
+	}
+	return quoted + "\"";
+}
+
+ProcessStats::ProcessStats(const TrackingConf& conf)
+		: roots(procfs::toPids(conf.pids)), timeline(conf.requested({TIREX_PROCESS_TIMELINE})) {}
+ProcessStats::~ProcessStats() { stopListener(); }
+
+ProcessStats::Process& ProcessStats::update(pid_t pid) {
+	auto stat = procfs::readStat(pid);
+	auto [it, inserted] = processes.try_emplace(pid);
+	if (!inserted && stat && it->second.startTicks != 0 && it->second.startTicks != stat->starttime) {
+		// The process exited (without us noticing) and its ID was assigned to a new process
+		reused.emplace_back(pid, std::move(it->second));
+		it->second = Process{};
+		inserted = true;
+	}
+	auto& process = it->second;
+	if (!process.exitMs && (!stat || stat->state == 'Z' || stat->state == 'X'))
+		process.exitMs = clockMs(CLOCK_MONOTONIC) - monotonicMsAtStart;
+	if (inserted) {
+		process.startMs = clockMs(CLOCK_MONOTONIC) - monotonicMsAtStart;
+		if (stat) {
+			process.ppid = stat->ppid;
+			process.startTicks = stat->starttime;
+			process.startMs = static_cast<int64_t>(procfs::ticksToMs(stat->starttime)) - bootMsAtStart;
+		}
+	}
+	if (!timeline)
+		return process;
+	if (process.command.empty()) {
+		process.command = procfs::readCmdline(pid);
+		if (process.command.empty() && stat)
+			process.command = "[" + stat->comm + "]"; // Like ps(1) does for processes without a command line
+	}
+	if (stat)
+		process.cpuMs = std::max(process.cpuMs, procfs::ticksToMs(stat->utime + stat->stime));
+	// Section 1.2 and Table 1-2 in https://www.kernel.org/doc/html/latest/filesystems/proc.html (values are in kB)
+	auto status = procfs::readFields(procfs::pidPath(pid) / "status");
+	if (auto hwm = status.find("VmHWM"); hwm != status.end())
+		process.peakRssKB = std::max(process.peakRssKB, hwm->second);
+	if (auto io = procfs::readIo(pid); io) {
+		process.readKB = std::max(process.readKB, io->rchar / 1000);
+		process.writeKB = std::max(process.writeKB, io->wchar / 1000);
+	}
+	return process;
+}
+
+bool ProcessStats::startListening() {
+	// See Documentation/driver-api/connector.rst and include/uapi/linux/cn_proc.h in the kernel sources
+	netlinkSocket = socket(PF_NETLINK, SOCK_DGRAM | SOCK_CLOEXEC, NETLINK_CONNECTOR);
+	if (netlinkSocket < 0)
+		return false;
+	sockaddr_nl addr{};
+	addr.nl_family = AF_NETLINK;
+	addr.nl_groups = CN_IDX_PROC;
+	alignas(nlmsghdr) char buffer[NLMSG_SPACE(sizeof(cn_msg) + sizeof(proc_cn_mcast_op))] = {};
+	auto header = reinterpret_cast<nlmsghdr*>(buffer);
+	header->nlmsg_len = NLMSG_LENGTH(sizeof(cn_msg) + sizeof(proc_cn_mcast_op));
+	header->nlmsg_type = NLMSG_DONE;
+	auto msg = static_cast<cn_msg*>(NLMSG_DATA(header));
+	msg->id.idx = CN_IDX_PROC;
+	msg->id.val = CN_VAL_PROC;
+	msg->len = sizeof(proc_cn_mcast_op);
+	*reinterpret_cast<proc_cn_mcast_op*>(msg->data) = PROC_CN_MCAST_LISTEN;
+	if (bind(netlinkSocket, reinterpret_cast<sockaddr*>(&addr), sizeof(addr)) != 0 ||
+		send(netlinkSocket, header, header->nlmsg_len, 0) < 0) {
+		tirex::log::info(
+				"processstats", "Could not subscribe to process events ({}), processes are only sampled",
+				std::strerror(errno)
+		);
+		close(netlinkSocket);
+		netlinkSocket = -1;
+		return false;
+	}
+	return true;
+}
+
+void ProcessStats::stopListener() {
+	stopListening = true;
+	if (listener.joinable())
+		listener.join();
+	if (netlinkSocket >= 0) {
+		close(netlinkSocket); // Closing the socket also unsubscribes from the events
+		netlinkSocket = -1;
+	}
+}
+
+void ProcessStats::listen() {
+	alignas(nlmsghdr) char buffer[8192];
+	pollfd pfd{.fd = netlinkSocket, .events = POLLIN, .revents = 0};
+	while (!stopListening) {
+		if (poll(&pfd, 1, 100) <= 0)
+			continue;
+		auto len = recv(netlinkSocket, buffer, sizeof(buffer), 0);
+		if (len <= 0) {
+			if (errno == ENOBUFS)
+				tirex::log::warn("processstats", "Process events were lost since they arrived too quickly");
+			continue;
+		}
+		std::lock_guard lock(mutex);
+		for (auto header = reinterpret_cast<nlmsghdr*>(buffer); NLMSG_OK(header, len);
+			 header = NLMSG_NEXT(header, len)) {
+			if (header->nlmsg_type == NLMSG_NOOP || header->nlmsg_type == NLMSG_ERROR)
+				continue;
+			auto msg = static_cast<cn_msg*>(NLMSG_DATA(header));
+			if (msg->id.idx != CN_IDX_PROC || msg->id.val != CN_VAL_PROC)
+				continue;
+			auto event = reinterpret_cast<proc_event*>(msg->data);
+			auto timeMs = static_cast<int64_t>(event->timestamp_ns / 1000000) - monotonicMsAtStart;
+			switch (event->what) {
+			case proc_event::PROC_EVENT_FORK: {
+				const auto& fork = event->event_data.fork;
+				// Only new processes that are forked by a process we know are of interest (and not new threads)
+				if (fork.child_pid != fork.child_tgid || !processes.contains(fork.parent_tgid))
+					break;
+				auto& process = update(fork.child_tgid);
+				process.ppid = fork.parent_tgid;
+				process.startMs = timeMs;
+				break;
+			}
+			case proc_event::PROC_EVENT_EXEC: {
+				const auto& exec = event->event_data.exec;
+				if (auto it = processes.find(exec.process_tgid); it != processes.end()) {
+					// The process was replaced by a new program, whose command line we read unless it exited already
+					auto previous = std::move(it->second.command);
+					it->second.command.clear();
+					if (auto& process = update(exec.process_tgid); process.command.empty())
+						process.command = std::move(previous);
+				}
+				break;
+			}
+			case proc_event::PROC_EVENT_EXIT: {
+				const auto& exit = event->event_data.exit;
+				if (exit.process_pid != exit.process_tgid || !processes.contains(exit.process_tgid))
+					break;
+				auto& process = update(exit.process_tgid); // Collect the last statistics if the zombie is still around
+				process.exitMs = timeMs;
+				process.exitCode = toExitCode(exit.exit_code);
+				break;
+			}
+			default:
+				break;
+			}
+		}
+	}
+}
+
+void ProcessStats::start() {
+	bootMsAtStart = clockMs(CLOCK_BOOTTIME);
+	monotonicMsAtStart = clockMs(CLOCK_MONOTONIC);
+	// Subscribe first such that we do not miss processes that are spawned while we walk the process tree
+	if (startListening()) {
+		stopListening = false;
+		listener = std::thread(&ProcessStats::listen, this);
+	}
+	std::lock_guard lock(mutex);
+	for (auto pid : procfs::listProcessTree(roots))
+		update(pid);
+}
+
+void ProcessStats::stop() {
+	step();
+	stopListener();
+}
+
+void ProcessStats::step() {
+	auto tree = procfs::listProcessTree(roots);
+	std::lock_guard lock(mutex);
+	for (auto pid : tree)
+		update(pid);
+	// Also update processes that left the tree (e.g., since their parent exited) and notice those that exited
+	for (auto& [pid, process] : processes) {
+		if (!process.exitMs && std::find(tree.begin(), tree.end(), pid) == tree.end())
+			update(pid);
+	}
+}
+
+Stats ProcessStats::getStats() {
+	std::lock_guard lock(mutex);
+	if (!timeline)
+		return {{TIREX_PROCESS_COUNT, std::to_string(reused.size() + processes.size())}};
+	std::vector<std::pair<pid_t, const Process*>> timeline;
+	for (const auto& [pid, process] : reused)
+		timeline.emplace_back(pid, &process);
+	for (const auto& [pid, process] : processes)
+		timeline.emplace_back(pid, &process);
+	std::ranges::stable_sort(timeline, {}, [](const auto& entry) { return entry.second->startMs; });
+	std::vector<std::string> entries;
+	for (const auto& [pid, process] : timeline) {
+		entries.emplace_back(_fmt::format(
+				"{{pid: {}, ppid: {}, command: {}, start_ms: {}, exit_ms: {}, exit_code: {}, cpu_ms: {}, "
+				"peak_rss_kb: {}, read_kb: {}, write_kb: {}}}",
+				pid, process->ppid, quote(process->command), process->startMs,
+				process->exitMs ? std::to_string(*process->exitMs) : "null",
+				process->exitCode ? std::to_string(*process->exitCode) : "null", process->cpuMs, process->peakRssKB,
+				process->readKB, process->writeKB
+		));
+	}
+	return {{TIREX_PROCESS_TIMELINE, "[" + tirex::utils::join(entries, ',') + "]"},
+			{TIREX_PROCESS_COUNT, std::to_string(timeline.size())}};
+}
+#else
+ProcessStats::ProcessStats(const TrackingConf&) {
+	tirex::log::warn("processstats", "The process timeline is not supported on this platform");
+}
+ProcessStats::~ProcessStats() = default;
+
+void ProcessStats::start() {}
+void ProcessStats::stop() {}
+void ProcessStats::step() {}
+Stats ProcessStats::getStats() { return {}; }
+#endif
@@ -0,0 +1,90 @@
+#ifndef STATS_PROCESSSTATS_HPP
+#define STATS_PROCESSSTATS_HPP
+
+#include "../measure.hpp"
+#include "provider.hpp"
+
+#include <atomic>
+#include <cstdint>
+#include <map>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#if __linux__
+#include <sys/types.h>
+#endif
+
+namespace tirex {
+	/**
+	 * @brief Records a timeline of all processes that were part of the tracked process trees (pid, command line,
+	 * start and exit time, CPU time, peak RSS and I/O) such that the resources can be attributed to the individual
+	 * steps of a pipeline.
+	 * @details Currently, only Linux is supported. Processes are discovered by walking the process trees at every
+	 * polling step. If the tracker is allowed to listen to the kernel's process events (proc connector, requires
+	 * `CAP_NET_ADMIN`), processes are additionally recorded when they are forked, exec'd and exit, such that processes
+	 * that live shorter than the polling interval are captured as well and exit times are exact. The statistics of a
+	 * process are read from `/proc/<pid>/` whenever it is seen, so values that can only be read while the process is
+	 * alive (e.g., the peak RSS) may be missing for very short-lived ones.
+	 */
+	class ProcessStats final : public StatsProvider {
+	private:
+#if __linux__
+		struct Process {
+			pid_t ppid = 0;
+			uint64_t startTicks = 0; /**< The start time (in clock ticks since boot) to detect reused IDs **/
+			std::string command;
+			int64_t startMs = 0;		   /**< Start time relative to the start of the tracking (may be negative) **/
+			std::optional<int64_t> exitMs; /**< Exit time relative to the start of the tracking **/
+			std::optional<int> exitCode;   /**< Only known if the exit was reported by the proc connector **/
+			uint64_t cpuMs = 0;			   /**< User and system time spent by the process itself **/
+			uint64_t peakRssKB = 0;
+			/** Kilobytes read using read(2) and similar system calls (including children that were waited for) **/
+			uint64_t readKB = 0;
+			/** Kilobytes written using write(2) and similar system calls (including children that were waited for) **/
+			uint64_t writeKB = 0;
+		};
+
+		std::vector<pid_t> roots;
+		/** Whether the timeline was requested, otherwise the statistics of the processes are not read **/
+		const bool timeline;
+		std::mutex mutex; /**< Guards the process lists, which are updated by step() and the listener thread **/
+		std::map<pid_t, Process> processes;
+		std::vector<std::pair<pid_t, Process>> reused; /**< Processes whose ID was reused by a later process **/
+		int64_t bootMsAtStart = 0;		/**< CLOCK_BOOTTIME (in milliseconds) when tracking started **/
+		int64_t monotonicMsAtStart = 0; /**< CLOCK_MONOTONIC (in milliseconds) when tracking started **/
+
+		int netlinkSocket = -1;
+		std::atomic<bool> stopListening = false;
+		std::thread listener;
+
+		/**
+		 * @brief Reads the current statistics of the process from procfs and adds it to the timeline if it is new.
+		 * @details Must be called with ProcessStats::mutex being held. If the process is no longer alive and no exit
+		 * time was recorded yet, the current time is used as an upper bound.
+		 */
+		Process& update(pid_t pid);
+		bool startListening();
+		void stopListener();
+		void listen();
+#endif
+
+	public:
+		explicit ProcessStats(const TrackingConf& conf);
+		~ProcessStats();
+
+		void start() override;
+		void stop() override;
+		void step() override;
+		Stats getStats() override;
+
+		static constexpr const char* description = "Collects a timeline of all processes in the tracked trees.";
+		static const char* version;
+		static const std::set<tirexMeasure> measures;
+	};
+} // namespace tirex
+
+#endif
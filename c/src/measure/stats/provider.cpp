@@ -5,27 +5,74 @@
 #include "energystats.hpp"
 #include "gitstats.hpp"
 #include "gpustats.hpp"
+#include "iostats.hpp"
+#include "memorystats.hpp"
+#include "pagecachestats.hpp"
+#include "perfstats.hpp"
+#include "pressurestats.hpp"
+#include "processstats.hpp"
+#include "schedstats.hpp"
 #include "systemstats.hpp"
+#include "thermalstats.hpp"
+#include "threadstats.hpp"
 
 #include <algorithm>
+#include <cassert>
 
 using tirex::EnergyStats;
 using tirex::GitStats;
 using tirex::GPUStats;
+using tirex::IOStats;
+using tirex::MemoryStats;
+using tirex::PageCacheStats;
+using tirex::PerfStats;
+using tirex::PressureStats;
+using tirex::ProcessStats;
+using tirex::SchedStats;
 using tirex::StatsProvider;
 using tirex::SystemStats;
+using tirex::ThermalStats;
+using tirex::ThreadStats;
 
 const std::map<std::string, tirex::ProviderEntry> tirex::providers{
-		{"system",
-		 {std::make_unique<SystemStats>, SystemStats::measures, SystemStats::version, SystemStats::description}},
-		{"energy",
-		 {std::make_unique<EnergyStats>, EnergyStats::measures, EnergyStats::version, EnergyStats::description}},
-		{"git", {std::make_unique<GitStats>, GitStats::measures, GitStats::version, GitStats::description}},
-		{"gpu", {std::make_unique<GPUStats>, GPUStats::measures, GPUStats::version, GPUStats::description}}
+		{"system", {makeProvider<SystemStats>, SystemStats::measures, SystemStats::version, SystemStats::description}},
+		{"energy", {makeProvider<EnergyStats>, EnergyStats::measures, EnergyStats::version, EnergyStats::description}},
+		{"git", {makeProvider<GitStats>, GitStats::measures, GitStats::version, GitStats::description}},
+		{"gpu", {makeProvider<GPUStats>, GPUStats::measures, GPUStats::version, GPUStats::description}},
+		{"threads", {makeProvider<ThreadStats>, ThreadStats::measures, ThreadStats::version, ThreadStats::description}},
+		{"perf", {makeProvider<PerfStats>, PerfStats::measures, PerfStats::version, PerfStats::description}},
+		{"io", {makeProvider<IOStats>, IOStats::measures, IOStats::version, IOStats::description}},
+		{"pressure",
+		 {makeProvider<PressureStats>, PressureStats::measures, PressureStats::version, PressureStats::description}},
+		{"memory", {makeProvider<MemoryStats>, MemoryStats::measures, MemoryStats::version, MemoryStats::description}},
+		{"pagecache",
+		 {makeProvider<PageCacheStats>, PageCacheStats::measures, PageCacheStats::version,
+		  PageCacheStats::description}},
+		{"processes",
+		 {makeProvider<ProcessStats>, ProcessStats::measures, ProcessStats::version, ProcessStats::description}},
+		{"thermal",
+		 {makeProvider<ThermalStats>, ThermalStats::measures, ThermalStats::version, ThermalStats::description}},
+		{"scheduler", {makeProvider<SchedStats>, SchedStats::measures, SchedStats::version, SchedStats::description}}
 };
 
-std::set<tirexMeasure>
-tirex::initProviders(std::set<tirexMeasure> measures, std::vector<std::unique_ptr<StatsProvider>>& providers) {
+std::set<tirexMeasure> tirex::initProviders(
+		std::set<tirexMeasure> measures, std::vector<std::unique_ptr<StatsProvider>>& providers,
+		const TrackingConf& conf
+) {
+#ifndef NDEBUG
+	// Each measure must belong to a single provider, otherwise the first one (by name) silently claims it
+	static const bool disjoint = [] {
+		std::set<tirexMeasure> claimed;
+		for (const auto& [_, info] : tirex::providers) {
+			for (auto measure : info.measures) {
+				if (!claimed.insert(measure).second)
+					return false;
+			}
+		}
+		return true;
+	}();
+	assert(disjoint);
+#endif
 	for (auto& [_, info] : tirex::providers) {
 		std::set<tirexMeasure> diff;
 		std::set_difference(
@@ -33,7 +80,11 @@ tirex::initProviders(std::set<tirexMeasure> measures, std::vector<std::unique_pt
 				std::inserter(diff, diff.begin())
 		);
 		if (diff.size() != measures.size()) { // The provider is responsible for some of the requested measures
-			providers.emplace_back(info.constructor());
+			auto providerConf = conf;
+			std::ranges::set_intersection(
+					measures, info.measures, std::inserter(providerConf.measures, providerConf.measures.end())
+			);
+			providers.emplace_back(info.constructor(providerConf));
 		}
 		measures = std::move(diff);
 	}
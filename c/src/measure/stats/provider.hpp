@@ -5,15 +5,20 @@
 
 #include "../measure.hpp"
 
+#include <cstdint>
+#include <algorithm>
 #include <functional>
+#include <initializer_list>
 #include <map>
 #include <memory>
 #include <set>
 #include <string>
+#include <type_traits>
 #include <variant>
+#include <vector>
 
 namespace tirex {
-	using StatVal = std::variant<std::string, tirex::TimeSeries<unsigned>>;
+	using StatVal = std::variant<std::string, tirex::TimeSeries<unsigned>, tirex::TimeSeriesMatrix<unsigned>>;
 	using Stats = std::map<tirexMeasure, StatVal>;
 
 	tirexResult_st* createMsrResultFromStats(Stats&& stats);
@@ -52,7 +57,36 @@ namespace tirex {
 		virtual Stats getInfo() { return {}; }
 	};
 
-	using ProviderConstructor = std::function<std::unique_ptr<StatsProvider>(void)>;
+	/**
+	 * @brief Configures what the providers should track.
+	 */
+	struct TrackingConf final {
+		/** The IDs of the processes to track. If empty, the calling process is tracked. **/
+		std::vector<uint32_t> pids;
+		/**
+		 * The measures that were requested from the provider. Providers should only compute or sample what is needed
+		 * for them. If empty, all measures of the provider are requested.
+		 */
+		std::set<tirexMeasure> measures;
+
+		/** @brief Returns true if at least one of the given measures was requested. **/
+		bool requested(std::initializer_list<tirexMeasure> any) const {
+			auto contained = [this](tirexMeasure measure) { return measures.contains(measure); };
+			return measures.empty() || std::ranges::any_of(any, contained);
+		}
+	};
+
+	using ProviderConstructor = std::function<std::unique_ptr<StatsProvider>(const TrackingConf&)>;
+	/**
+	 * @brief Constructs a provider of type T, passing it the tracking configuration if it accepts one.
+	 */
+	template <typename T>
+	std::unique_ptr<StatsProvider> makeProvider(const TrackingConf& conf) {
+		if constexpr (std::is_constructible_v<T, const TrackingConf&>)
+			return std::make_unique<T>(conf);
+		else
+			return std::make_unique<T>();
+	}
 	struct ProviderEntry final {
 		ProviderConstructor constructor;
 		const std::set<tirexMeasure>& measures; /**< The set of measures that the provider is responsible for */
@@ -61,8 +95,10 @@ namespace tirex {
 	};
 	extern const std::map<std::string, ProviderEntry> providers;
 
-	std::set<tirexMeasure>
-	initProviders(std::set<tirexMeasure> measures, std::vector<std::unique_ptr<StatsProvider>>& providers);
+	std::set<tirexMeasure> initProviders(
+			std::set<tirexMeasure> measures, std::vector<std::unique_ptr<StatsProvider>>& providers,
+			const TrackingConf& conf = {}
+	);
 } // namespace tirex
 
 #endif
\ No newline at end of file
@@ -0,0 +1,119 @@
+#include "schedstats.hpp"
+
+#include "../../logging.hpp"
+#include "../utils/procfs.hpp"
+
+#include <filesystem>
+#include <fstream>
+#include <string>
+
+#if __linux__
+#include <unistd.h>
+#endif
+
+using tirex::SchedStats;
+using tirex::Stats;
+
+const char* SchedStats::version = nullptr;
+const std::set<tirexMeasure> SchedStats::measures{
+		TIREX_CPU_RUN_TIME_PROCESS_MS, TIREX_CPU_WAIT_TIME_PROCESS_MS, TIREX_CPU_TIMESLICES_PROCESS,
+		TIREX_CPU_WAIT_PROCESS_PERCENT, TIREX_IO_BLOCK_DELAY_PROCESS_MS, TIREX_CPU_RUN_TIME_STEPS_PROCESS_MS,
+		TIREX_CPU_WAIT_TIME_STEPS_PROCESS_MS, TIREX_CPU_TIMESLICES_STEPS_PROCESS
+};
+
+#if __linux__
+namespace procfs = tirex::utils::procfs;
+
+SchedStats::SchedStats(const TrackingConf& conf)
+		: pids(procfs::toPids(conf.pids)), delayAccounting(conf.requested({TIREX_IO_BLOCK_DELAY_PROCESS_MS})) {
+	if (!delayAccounting)
+		return;
+	// The sysctl exists since Linux 5.14, before that delay accounting was enabled unless booted with nodelayacct
+	std::ifstream is("/proc/sys/kernel/task_delayacct");
+	if (int enabled; is >> enabled && enabled == 0) {
+		delayAccounting = false;
+		tirex::log::info(
+				"schedstats", "Delay accounting is disabled (kernel.task_delayacct = 0), the block I/O delay is omitted"
+		);
+	}
+}
+
+SchedStats::Counters SchedStats::update(bool initial) {
+	for (auto process : procfs::listProcessTree(pids)) {
+		for (auto tid : procfs::listTasks(process)) {
+			if (tid == monitorTid)
+				continue;
+			auto sched = procfs::readSchedStat(process, tid);
+			if (!sched)
+				continue; // The thread exited in the meantime (or the kernel does not provide schedstat)
+			auto stat = delayAccounting ? procfs::readStat(process, tid) : std::nullopt;
+			Counters counters{
+					.runNs = sched->runNs,
+					.waitNs = sched->waitNs,
+					.timeslices = sched->timeslices,
+					.blkioTicks = stat ? stat->blkioTicks : 0
+			};
+			auto [it, inserted] = threads.try_emplace(tid);
+			auto& thread = it->second;
+			if (inserted) {
+				// Threads that already exist when tracking starts only count what they do from then on
+				if (initial)
+					thread.start = counters;
+			} else if (counters.runNs < thread.last.runNs) {
+				// The thread ID was reused by a new thread, so we keep what its predecessor accumulated
+				reused += thread.last - thread.start;
+				thread.start = {};
+			}
+			thread.last = counters;
+		}
+	}
+	auto total = reused;
+	for (const auto& [tid, thread] : threads)
+		total += thread.last - thread.start;
+	return total;
+}
+
+void SchedStats::start() {
+	if (!std::filesystem::exists("/proc/self/schedstat"))
+		tirex::log::warn("schedstats", "The kernel does not provide scheduler statistics (CONFIG_SCHED_INFO)");
+	lastTotal = update(true);
+}
+void SchedStats::stop() { lastTotal = update(); }
+void SchedStats::step() {
+	if (monitorTid == 0)
+		monitorTid = gettid();
+	auto total = update();
+	auto delta = total - lastTotal;
+	// The share of the time the threads were runnable that they spent waiting for a CPU
+	auto runnableNs = delta.runNs + delta.waitNs;
+	waitPercent.addValue(static_cast<unsigned>((runnableNs != 0) ? delta.waitNs * 100 / runnableNs : 0));
+	runMs.addValue(static_cast<unsigned>(delta.runNs / 1000000));
+	waitMs.addValue(static_cast<unsigned>(delta.waitNs / 1000000));
+	timeslices.addValue(static_cast<unsigned>(delta.timeslices));
+	lastTotal = total;
+}
+
+Stats SchedStats::getStats() {
+	Stats stats{
+			{TIREX_CPU_RUN_TIME_PROCESS_MS, std::to_string(lastTotal.runNs / 1000000)},
+			{TIREX_CPU_WAIT_TIME_PROCESS_MS, std::to_string(lastTotal.waitNs / 1000000)},
+			{TIREX_CPU_TIMESLICES_PROCESS, std::to_string(lastTotal.timeslices)},
+			{TIREX_CPU_WAIT_PROCESS_PERCENT, waitPercent},
+			{TIREX_CPU_RUN_TIME_STEPS_PROCESS_MS, runMs},
+			{TIREX_CPU_WAIT_TIME_STEPS_PROCESS_MS, waitMs},
+			{TIREX_CPU_TIMESLICES_STEPS_PROCESS, timeslices}
+	};
+	if (delayAccounting)
+		stats.insert({TIREX_IO_BLOCK_DELAY_PROCESS_MS, std::to_string(procfs::ticksToMs(lastTotal.blkioTicks))});
+	return stats;
+}
+#else
+SchedStats::SchedStats(const TrackingConf&) {
+	tirex::log::warn("schedstats", "Scheduler statistics are not supported on this platform");
+}
+
+void SchedStats::start() {}
+void SchedStats::stop() {}
+void SchedStats::step() {}
+Stats SchedStats::getStats() { return {}; }
+#endif
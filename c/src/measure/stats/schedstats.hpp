@@ -0,0 +1,85 @@
+#ifndef STATS_SCHEDSTATS_HPP
+#define STATS_SCHEDSTATS_HPP
+
+#include "../measure.hpp"
+#include "provider.hpp"
+
+#include <cstdint>
+#include <map>
+#include <vector>
+
+#if __linux__
+#include <sys/types.h>
+#endif
+
+namespace tirex {
+	/**
+	 * @brief Collects how long the threads of the tracked processes ran on a CPU, how long they were runnable but had
+	 * to wait for a CPU (run-queue delay) and how long they were blocked on I/O, which reveals oversubscribed machines.
+	 * @details Currently, only Linux is supported, where the statistics are read from
+	 * `/proc/<pid>/task/<tid>/schedstat` (requires CONFIG_SCHED_INFO) and `/proc/<pid>/task/<tid>/stat`. The block
+	 * I/O delay is only reported if delay accounting is enabled (`sysctl kernel.task_delayacct=1`).
+	 */
+	class SchedStats final : public StatsProvider {
+	private:
+		tirex::TimeSeries<unsigned> waitPercent{true};
+		tirex::TimeSeries<unsigned> runMs{true};  /**< The time spent running on a CPU during each step **/
+		tirex::TimeSeries<unsigned> waitMs{true}; /**< The time spent waiting on a run queue during each step **/
+		tirex::TimeSeries<unsigned> timeslices{true};
+
+#if __linux__
+		struct Counters {
+			uint64_t runNs = 0;
+			uint64_t waitNs = 0;
+			uint64_t timeslices = 0;
+			uint64_t blkioTicks = 0;
+
+			Counters& operator+=(const Counters& other) noexcept {
+				runNs += other.runNs;
+				waitNs += other.waitNs;
+				timeslices += other.timeslices;
+				blkioTicks += other.blkioTicks;
+				return *this;
+			}
+			Counters operator-(const Counters& other) const noexcept {
+				return {.runNs = runNs - other.runNs,
+						.waitNs = waitNs - other.waitNs,
+						.timeslices = timeslices - other.timeslices,
+						.blkioTicks = blkioTicks - other.blkioTicks};
+			}
+		};
+		struct Thread {
+			Counters start; /**< The counters before tracking started (0 for threads that were created later) **/
+			Counters last;	/**< The counters at the last update **/
+		};
+		std::vector<pid_t> pids;
+		pid_t monitorTid = 0; /**< The thread calling step(), which should not be accounted to the tracked process **/
+		/** Whether the block I/O delay was requested and the kernel accounts it, only then `stat` is read **/
+		bool delayAccounting = true;
+		std::map<pid_t, Thread> threads; /**< Also contains the threads that exited to keep their last known values **/
+		Counters reused; /**< What threads accumulated whose ID was later reused by another thread **/
+		Counters lastTotal;
+
+		/**
+		 * @brief Reads the counters of all threads of the tracked process tree and updates the bookkeeping.
+		 * @param initial If true, what the threads accumulated up until now is not accounted to the tracked period.
+		 * @return the sum of the counters of all threads since tracking started.
+		 */
+		Counters update(bool initial = false);
+#endif
+
+	public:
+		explicit SchedStats(const TrackingConf& conf);
+
+		void start() override;
+		void stop() override;
+		void step() override;
+		Stats getStats() override;
+
+		static constexpr const char* description = "Collects scheduler latency and off-CPU time of the process.";
+		static const char* version;
+		static const std::set<tirexMeasure> measures;
+	};
+} // namespace tirex
+
+#endif
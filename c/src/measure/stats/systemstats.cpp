@@ -6,6 +6,11 @@
 #include "systemstats.hpp"
 
 #include "../../logging.hpp"
+#include "../utils/infocache.hpp"
+#include "../utils/rangeutils.hpp"
+#if __linux__
+#include "../utils/sysfs.hpp"
+#endif
 
 #include <cpuinfo.h>
 
@@ -17,8 +22,10 @@ namespace _fmt = std;
 namespace _fmt = fmt;
 #endif
 
+#include <algorithm>
 #include <fstream>
 #include <map>
+#include <set>
 #include <sstream>
 #include <tuple>
 
@@ -34,7 +41,9 @@ uint32_t cpuinfo_linux_get_processor_min_frequency(uint32_t processor);
 uint32_t cpuinfo_linux_get_processor_max_frequency(uint32_t processor);
 }
 std::tuple<uint32_t, uint32_t> getProcessorMinMaxFreq(uint32_t processor) {
-	return {cpuinfo_linux_get_processor_min_frequency(processor), cpuinfo_linux_get_processor_max_frequency(processor)};
+	// cpufreq reports frequencies in kHz
+	return {cpuinfo_linux_get_processor_min_frequency(processor) / 1000,
+			cpuinfo_linux_get_processor_max_frequency(processor) / 1000};
 }
 #elif _WINDOWS
 #include <powrprof.h>
@@ -92,10 +101,21 @@ const std::set<tirexMeasure> SystemStats::measures{
 		TIREX_CPU_THREADS_PER_CORE,
 		TIREX_CPU_CACHES,
 		TIREX_CPU_VIRTUALIZATION,
+		TIREX_CPU_CORE_TYPES,
+		TIREX_CPU_CACHE_TOPOLOGY,
+		TIREX_CPU_NUMA_NODES,
 
 		TIREX_RAM_USED_PROCESS_KB,
 		TIREX_RAM_USED_SYSTEM_MB,
-		TIREX_RAM_AVAILABLE_SYSTEM_MB
+		TIREX_RAM_AVAILABLE_SYSTEM_MB,
+
+		TIREX_CPU_USED_CORES_PERCENT,
+		TIREX_CPU_FREQUENCY_CORES_MHZ,
+		TIREX_CPU_ACTIVE_CORES_SYSTEM,
+		TIREX_CPU_USED_CORE_TYPES_PERCENT,
+
+		TIREX_CPU_USED_PIDS_PERCENT,
+		TIREX_RAM_USED_PIDS_KB
 };
 
 std::map<cpuinfo_vendor, const char*> vendorToStr{
@@ -301,6 +321,23 @@ static std::string armImplementerToStr(uint32_t midr) {
 	return _fmt::format("Unknown Implementer ({:#04x})", implementer);
 }
 
+SystemStats::Sampling SystemStats::toSampling(const TrackingConf& conf) {
+	return {.processCpu = conf.requested({TIREX_CPU_USED_PROCESS_PERCENT, TIREX_CPU_USED_PIDS_PERCENT}),
+			.systemCpu = conf.requested(
+					{TIREX_CPU_USED_SYSTEM_PERCENT, TIREX_CPU_USED_CORES_PERCENT, TIREX_CPU_ACTIVE_CORES_SYSTEM}
+			),
+			.processRam = conf.requested({TIREX_RAM_USED_PROCESS_KB, TIREX_RAM_USED_PIDS_KB}),
+			.systemRam = conf.requested({TIREX_RAM_USED_SYSTEM_MB}),
+			.frequency = conf.requested({TIREX_CPU_FREQUENCY_MHZ}),
+			.coreFrequency = conf.requested({TIREX_CPU_FREQUENCY_CORES_MHZ}),
+#if __linux__
+			.coreTypes = conf.requested({TIREX_CPU_USED_CORE_TYPES_PERCENT})
+#else
+			.coreTypes = false
+#endif
+	};
+}
+
 template <uint32_t SystemStats::CPUInfo::Cache::* entry>
 static void aggCaches(SystemStats::CPUInfo::Cache& dest, const cpuinfo_cache* caches, uint32_t num) {
 	for (auto i = 0u; i < num; ++i)
@@ -321,6 +358,44 @@ static std::vector<SystemStats::CPUInfo::Cache> getCaches() {
 	return {std::begin(layer), std::end(layer)};
 }
 
+static std::vector<SystemStats::CPUInfo::CacheGroup> getCacheGroups() {
+	// Assumes cpuinfo to be initialized
+	std::vector<SystemStats::CPUInfo::CacheGroup> groups;
+	auto add = [&groups](const char* level, const cpuinfo_cache* caches, uint32_t num) {
+		for (auto i = 0u; i < num; ++i) {
+			auto it = std::ranges::find_if(groups, [&](const auto& group) {
+				return group.level == level && group.size == caches[i].size &&
+					   group.processors == caches[i].processor_count;
+			});
+			if (it != groups.end())
+				++it->instances;
+			else
+				groups.push_back({.level = level,
+								  .size = caches[i].size,
+								  .processors = caches[i].processor_count,
+								  .instances = 1});
+		}
+	};
+	add("l1i", cpuinfo_get_l1i_caches(), cpuinfo_get_l1i_caches_count());
+	add("l1d", cpuinfo_get_l1d_caches(), cpuinfo_get_l1d_caches_count());
+	add("l2", cpuinfo_get_l2_caches(), cpuinfo_get_l2_caches_count());
+	add("l3", cpuinfo_get_l3_caches(), cpuinfo_get_l3_caches_count());
+	add("l4", cpuinfo_get_l4_caches(), cpuinfo_get_l4_caches_count());
+	return groups;
+}
+
+/** @brief Formats the (sorted) IDs of processors as ranges like sysfs does (e.g., 0-3,8,10-11). **/
+static std::string toRanges(const std::vector<uint32_t>& ids) {
+	std::vector<std::string> ranges;
+	for (size_t first = 0, last = 0; first < ids.size(); first = ++last) {
+		while (last + 1 < ids.size() && ids[last + 1] == ids[last] + 1)
+			++last;
+		auto range = (first == last) ? std::to_string(ids[first]) : _fmt::format("{}-{}", ids[first], ids[last]);
+		ranges.emplace_back(std::move(range));
+	}
+	return tirex::utils::join(ranges, ',');
+}
+
 static std::string getFlagStr() {
 	std::ostringstream stream;
 	for (auto&& [name, pred] : flags) {
@@ -355,8 +430,6 @@ SystemStats::CPUInfo::VirtFlags getVirtSupport() {
 #error "getVirtSupport not supported for this OS"
 #endif
 
-SystemStats::SystemStats() {}
-
 SystemStats::CPUInfo SystemStats::getCPUInfo() {
 	cpuinfo_initialize();
 	auto numProcessors = cpuinfo_get_processors_count();
@@ -368,10 +441,11 @@ SystemStats::CPUInfo SystemStats::getCPUInfo() {
 			"system", "Found {} physical and {} logical processors with a total of {} cores clustered into {} clusters",
 			numPackages, numProcessors, numCores, numClusters
 	);
-	if (numClusters > 1) {
-		tirex::log::warn(
-				"system", "I found that {} CPU clusters are installed and will only output statistics for the first",
-				numClusters
+	auto coreTypes = getCoreTypes();
+	if (coreTypes.size() > 1) {
+		tirex::log::info(
+				"system", "Found {} kinds of cores; the model name and vendor are those of the first cluster",
+				coreTypes.size()
 		);
 	}
 	auto cluster = cpuinfo_get_cluster(0);
@@ -383,7 +457,14 @@ SystemStats::CPUInfo SystemStats::getCPUInfo() {
 					? "Big Endian"
 					: ((std::endian::native == std::endian::little) ? "Little Endian" : "Mixed Endian");
 
+	// Heterogeneous CPUs span the frequency ranges of all kinds of cores
 	auto [minFreq, maxFreq] = getProcessorMinMaxFreq(0);
+	for (const auto& type : coreTypes) {
+		for (const auto& [range, _] : type.frequencies) {
+			minFreq = std::min(minFreq, range.first);
+			maxFreq = std::max(maxFreq, range.second);
+		}
+	}
 
 	return CPUInfo{
 			.modelname = cluster->package->name,
@@ -401,12 +482,83 @@ SystemStats::CPUInfo SystemStats::getCPUInfo() {
 			.frequency_min = minFreq,
 			.frequency_max = maxFreq,
 			.flags = std::move(getFlagStr()),
-			.virtualization = getVirtSupport()
+			.virtualization = getVirtSupport(),
+			.coreTypes = std::move(coreTypes),
+			.cacheGroups = getCacheGroups()
+	};
+}
+
+std::vector<SystemStats::CPUInfo::CoreType> SystemStats::getCoreTypes() {
+	cpuinfo_initialize();
+	auto numProcessors = cpuinfo_get_processors_count();
+	auto osId = [](uint32_t processor) {
+#if __linux__
+		return static_cast<uint32_t>(cpuinfo_get_processor(processor)->linux_id);
+#else
+		return processor;
+#endif
+	};
+
+	// The kind of core of each processor (by cpuinfo's index of the processor)
+	std::vector<size_t> typeOf(numProcessors, 0);
+	bool grouped = false;
+#if __linux__
+	// On x86, cpuinfo only decodes the microarchitecture of the processor it runs on but the kernel tells them apart
+	namespace sysfs = tirex::utils::sysfs;
+	if (auto atoms = sysfs::readCpuList(sysfs::root() / "devices/cpu_atom/cpus"); !atoms.empty()) {
+		for (uint32_t i = 0; i < numProcessors; ++i)
+			typeOf[i] = std::ranges::binary_search(atoms, osId(i)) ? 1 : 0;
+		grouped = true;
+	}
+#endif
+	if (!grouped) {
+		std::map<cpuinfo_uarch, size_t> uarchs;
+		for (uint32_t i = 0; i < numProcessors; ++i)
+			typeOf[i] = uarchs.try_emplace(cpuinfo_get_processor(i)->core->uarch, uarchs.size()).first->second;
+	}
+
+	std::map<size_t, CPUInfo::CoreType> types;
+	std::map<size_t, std::set<const cpuinfo_core*>> cores;
+	for (uint32_t i = 0; i < numProcessors; ++i) {
+		auto& type = types[typeOf[i]];
+		auto id = osId(i);
+		auto [minFreq, maxFreq] = getProcessorMinMaxFreq(id);
+		type.processors.emplace_back(id);
+		type.frequencies[{minFreq, maxFreq}].emplace_back(id);
+		cores[typeOf[i]].insert(cpuinfo_get_processor(i)->core);
+	}
+	std::vector<CPUInfo::CoreType> result;
+	for (auto& [index, type] : types) {
+		type.numCores = static_cast<uint32_t>(cores[index].size());
+		std::ranges::sort(type.processors);
+		result.emplace_back(std::move(type));
+	}
+	auto maxFrequency = [](const CPUInfo::CoreType& type) {
+		uint32_t max = 0;
+		for (const auto& [range, _] : type.frequencies)
+			max = std::max(max, range.second);
+		return max;
 	};
+	std::ranges::stable_sort(result, std::greater{}, maxFrequency);
+	for (size_t i = 0; i < result.size(); ++i) {
+		if (result.size() == 1)
+			result[i].label = "default";
+		else if (i == 0)
+			result[i].label = "performance";
+		else if (i + 1 == result.size())
+			result[i].label = "efficiency";
+		else
+			result[i].label = _fmt::format("mid{}", i);
+	}
+	return result;
 }
 
 Stats SystemStats::getInfo() {
-	/** \todo: filter by requested metrics */
+	// The information is static, so it is cached as a whole and only filtered afterwards (see tirexFetchInfo)
+	return tirex::utils::infocache::get("system", collectInfo);
+}
+
+Stats SystemStats::collectInfo() {
 	auto info = getSysInfo();
 	auto cpuInfo = getCPUInfo();
 
@@ -427,7 +579,32 @@ Stats SystemStats::getInfo() {
 		++cacheIdx;
 	}
 
-	return {{TIREX_OS_NAME, info.osname},
+	std::vector<std::string> coreTypes;
+	for (const auto& type : cpuInfo.coreTypes) {
+		std::vector<std::string> frequencies;
+		for (const auto& [range, processors] : type.frequencies)
+			frequencies.emplace_back(_fmt::format("{}-{}: [{}]", range.first, range.second, toRanges(processors)));
+		coreTypes.emplace_back(_fmt::format(
+				"{{type: {}, cores: {}, processors: [{}], frequency_mhz: {{{}}}}}", type.label, type.numCores,
+				toRanges(type.processors), tirex::utils::join(frequencies, ',')
+		));
+	}
+	std::vector<std::string> cacheLevels;
+	for (auto level : {"l1i", "l1d", "l2", "l3", "l4"}) {
+		std::vector<std::string> groups;
+		for (const auto& group : cpuInfo.cacheGroups) {
+			if (group.level == level)
+				groups.emplace_back(_fmt::format(
+						"{{size_kib: {}, shared_by: {}, count: {}}}", group.size / 1024, group.processors,
+						group.instances
+				));
+		}
+		if (!groups.empty())
+			cacheLevels.emplace_back(_fmt::format("{}: [{}]", level, tirex::utils::join(groups, ',')));
+	}
+
+	Stats stats{
+			{TIREX_OS_NAME, info.osname},
 			{TIREX_OS_KERNEL, info.kerneldesc},
 			{TIREX_CPU_AVAILABLE_SYSTEM_CORES, std::to_string(cpuInfo.numCores)},
 			{TIREX_CPU_FEATURES, cpuInfo.flags},
@@ -442,22 +619,39 @@ Stats SystemStats::getInfo() {
 			{TIREX_CPU_CACHES, caches},
 			{TIREX_CPU_VIRTUALIZATION,
 			 (cpuInfo.virtualization.svm ? "AMD-V "s : ""s) + (cpuInfo.virtualization.vmx ? "VT-x"s : ""s)},
-			{TIREX_RAM_AVAILABLE_SYSTEM_MB, std::to_string(info.totalRamMB)}};
+			{TIREX_RAM_AVAILABLE_SYSTEM_MB, std::to_string(info.totalRamMB)},
+			{TIREX_CPU_CORE_TYPES, "[" + tirex::utils::join(coreTypes, ',') + "]"},
+			{TIREX_CPU_CACHE_TOPOLOGY, "{" + tirex::utils::join(cacheLevels, ',') + "}"}
+	};
+	if (!info.numaNodes.empty()) {
+		std::vector<std::string> nodes;
+		for (const auto& node : info.numaNodes)
+			nodes.emplace_back(_fmt::format(
+					"{{node: {}, processors: [{}], memory_mb: {}}}", node.id, toRanges(node.processors), node.memoryMB
+			));
+		stats.insert({TIREX_CPU_NUMA_NODES, "[" + tirex::utils::join(nodes, ',') + "]"});
+	}
+	return stats;
 }
 
 Stats SystemStats::getStats() {
-	/** \todo: filter by requested metrics */
 	auto wallclocktime =
 			std::to_string(std::chrono::duration_cast<std::chrono::milliseconds>(stoptime - starttime).count());
 
 	return {
 			{{TIREX_TIME_ELAPSED_WALL_CLOCK_MS, wallclocktime},
-			 {TIREX_TIME_ELAPSED_USER_MS, std::to_string(tickToMs(stopUTime - startUTime))},
-			 {TIREX_TIME_ELAPSED_SYSTEM_MS, std::to_string(tickToMs(stopSysTime - startSysTime))},
+			 {TIREX_TIME_ELAPSED_USER_MS, std::to_string(tickToMs(delta(stopUTime, startUTime)))},
+			 {TIREX_TIME_ELAPSED_SYSTEM_MS, std::to_string(tickToMs(delta(stopSysTime, startSysTime)))},
 			 {TIREX_CPU_USED_PROCESS_PERCENT, cpuUtil},
 			 {TIREX_CPU_USED_SYSTEM_PERCENT, sysCpuUtil},
 			 {TIREX_CPU_FREQUENCY_MHZ, frequency},
 			 {TIREX_RAM_USED_PROCESS_KB, ram},
-			 {TIREX_RAM_USED_SYSTEM_MB, sysRam}}
+			 {TIREX_RAM_USED_SYSTEM_MB, sysRam},
+			 {TIREX_CPU_USED_CORES_PERCENT, coreUtil},
+			 {TIREX_CPU_FREQUENCY_CORES_MHZ, coreFrequency},
+			 {TIREX_CPU_ACTIVE_CORES_SYSTEM, activeCores},
+			 {TIREX_CPU_USED_CORE_TYPES_PERCENT, coreTypeUtil},
+			 {TIREX_CPU_USED_PIDS_PERCENT, pidCpuUtil},
+			 {TIREX_RAM_USED_PIDS_KB, pidRam}}
 	};
 }
\ No newline at end of file
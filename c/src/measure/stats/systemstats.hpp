@@ -5,11 +5,16 @@
 #include "provider.hpp"
 
 #include <chrono>
+#include <map>
 #include <string>
 #include <tuple>
 #include <vector>
 
-#if _WINDOWS
+#if __linux__
+#include <sys/types.h>
+#elif __APPLE__
+#include <unistd.h>
+#elif _WINDOWS
 #include <windows.h>
 #undef ERROR //  Make problems with logging.h otherwise
 #endif
@@ -22,6 +27,12 @@ namespace tirex {
 			std::string kerneldesc;	  /**< The os kernel that is currently running **/
 			std::string architecture; /**< The architecture currently running on **/
 			uint64_t totalRamMB;	  /**< The total amount of RAM (in Megabytes) installed in the system **/
+			struct NumaNode {
+				unsigned id;
+				std::vector<uint32_t> processors; /**< The IDs of the logical processors of the node **/
+				uint64_t memoryMB;				  /**< The memory (in Megabytes) that is attached to the node **/
+			};
+			std::vector<NumaNode> numaNodes; /**< The NUMA nodes of the system (Linux only) **/
 		};
 		struct CPUInfo {
 			struct Cache {
@@ -43,9 +54,43 @@ namespace tirex {
 				bool svm; /**< AMD-V support **/
 				bool vmx; /**< VT-x support **/
 			} virtualization;
+			/** A kind of cores of a heterogeneous CPU (e.g., the performance or efficiency cores of hybrid CPUs) **/
+			struct CoreType {
+				std::string label; /**< performance, efficiency, mid<N> or default if all cores are alike **/
+				uint32_t numCores; /**< The number of physical cores of this type **/
+				std::vector<uint32_t> processors; /**< The (OS) IDs of the logical processors of this type **/
+				/** The IDs of the processors by their minimum and maximum frequency in MHz **/
+				std::map<std::pair<uint32_t, uint32_t>, std::vector<uint32_t>> frequencies;
+			};
+			std::vector<CoreType> coreTypes; /**< Ordered from the fastest to the slowest type **/
+			/** Cache instances of one level that have the same size and are shared by as many processors **/
+			struct CacheGroup {
+				std::string level;	 /**< l1i, l1d, l2, l3 or l4 **/
+				uint32_t size;		 /**< The size of each instance in bytes **/
+				uint32_t processors; /**< The number of logical processors that share each instance **/
+				uint32_t instances;
+			};
+			std::vector<CacheGroup> cacheGroups;
 		};
 
 	private:
+		/** Which of the series are sampled at every step (depending on the requested measures) **/
+		struct Sampling {
+			bool processCpu; /**< The CPU utilization of the tracked processes (in total and of each) **/
+			bool systemCpu;	 /**< The CPU utilization of the system and of each core and the number of active cores **/
+			bool processRam; /**< The RAM used by the tracked processes (in total and by each) **/
+			bool systemRam;
+			bool frequency;
+			bool coreFrequency;
+			bool coreTypes; /**< The CPU utilization of each kind of core (Linux only) **/
+
+			bool any() const {
+				return processCpu || systemCpu || processRam || systemRam || frequency || coreFrequency || coreTypes;
+			}
+		};
+		const Sampling sample;
+		static Sampling toSampling(const TrackingConf& conf);
+
 		std::chrono::steady_clock::time_point starttime;
 		std::chrono::steady_clock::time_point stoptime;
 
@@ -54,39 +99,81 @@ namespace tirex {
 		tirex::TimeSeries<unsigned> cpuUtil{true};
 		tirex::TimeSeries<unsigned> sysCpuUtil{true};
 		tirex::TimeSeries<uint32_t> frequency{true};
+		tirex::TimeSeriesMatrix<unsigned> coreUtil;
+		tirex::TimeSeriesMatrix<unsigned> coreFrequency;
+		tirex::TimeSeries<unsigned> activeCores{true};
+		tirex::TimeSeriesMatrix<unsigned> pidCpuUtil; /**< The CPU utilization of each tracked process (Linux only) **/
+		tirex::TimeSeriesMatrix<unsigned> pidRam;	  /**< The RAM used by each tracked process (Linux only) **/
+		/** The average CPU utilization of the processors of each kind of core (Linux only) **/
+		tirex::TimeSeriesMatrix<unsigned> coreTypeUtil;
 
 		size_t startUTime, stopUTime;
 		size_t startSysTime, stopSysTime;
 
 		struct Utilization {
-			unsigned ramUsedKB;		/**< Amount of RAM used by the monitored process alone **/
-			uint8_t cpuUtilization; /**< CPU utilization (in percent) of the tracked process **/
+			unsigned ramUsedKB;			/**< Amount of RAM used by the monitored process(es) alone **/
+			unsigned cpuUtilization;	/**< CPU utilization of the tracked process(es) (100 = one logical core) **/
 			struct {
 				unsigned ramUsedMB;		/**< Amount of RAM (in Megabytes) used by all processes **/
 				uint8_t cpuUtilization; /**< CPU utilization of all processes **/
+				/** CPU utilization (in percent) of each logical core **/
+				std::vector<unsigned> coreUtilization;
 			} system;
+			std::vector<unsigned> pidRamUsedKB;		 /**< Amount of RAM used by each of the tracked processes **/
+			std::vector<unsigned> pidCpuUtilization; /**< CPU utilization of each of the tracked processes **/
 		};
 		Utilization getUtilization();
 		std::tuple<size_t, size_t> getSysAndUserTime() const;
 		static size_t tickToMs(size_t tick);
+		/**
+		 * @brief Returns `now - before` or 0 if the time decreased (e.g., since a child left the tracked process tree).
+		 */
+		static size_t delta(size_t now, size_t before) { return (now > before) ? (now - before) : 0; }
+
+		unsigned getProcCPUUtilization();
+		/**
+		 * @brief Cores that were busy for at least this percentage of a step are counted as active.
+		 */
+		static constexpr unsigned activeCoreThreshold = 50;
 
-		uint8_t getProcCPUUtilization();
 #if __linux__
+		std::vector<pid_t> pids; /**< The tracked processes, which are accounted together with their children **/
+		/**
+		 * The highest system and user time (in ticks) of the process tree of each tracked process seen so far, which
+		 * is kept once the process exited. The sum over the tree decreases if a child leaves it (e.g., is orphaned) or
+		 * exits without being waited for, which would otherwise let the elapsed times run backwards.
+		 */
+		mutable std::map<pid_t, std::tuple<size_t, size_t>> lastPidTimes;
 		size_t lastIdle = 0;
 		size_t lastTotal = 0;
+		std::vector<size_t> lastCoreIdle;
+		std::vector<size_t> lastCoreTotal;
+		/** The last computed utilization, which is repeated if no time passed since (in ticks) **/
+		uint8_t lastCpuUtilization = 0;
+		std::vector<unsigned> lastCoreUtilization;
 		size_t lastProcActiveMs = 0;
+		std::vector<size_t> lastPidActiveMs;
 		std::chrono::steady_clock::time_point lastProcTime{};
-
+		/** The index of the kind of core (the column of coreTypeUtil) of each logical processor **/
+		std::vector<size_t> coreTypeOf;
+
+		/**
+		 * @brief Lists the process tree of each tracked process. Processes that are part of more than one of the trees
+		 * are only listed in the first one.
+		 */
+		std::vector<std::vector<pid_t>> listTrees() const;
 		void parseMemInfo(Utilization& utilization);
 		void parseStat(Utilization& utilization);
-		void parseStatm(pid_t pid, Utilization& utilization);
+		void parseStatm(Utilization& utilization);
 #elif _WINDOWS
+		HANDLE process; /**< The tracked process **/
 		FILETIME prevSysIdle, prevSysKernel, prevSysUser;
 		ULARGE_INTEGER lastCPU, lastSysCPU, lastUserCPU;
 		unsigned numProcessors;
 
 		uint8_t getCPUUtilization();
 #elif __APPLE__
+		pid_t pid; /**< The tracked process **/
 		size_t lastIdle = 0;
 		size_t lastTotal = 0;
 		size_t lastProcActiveMs = 0;
@@ -96,7 +183,10 @@ namespace tirex {
 #endif
 
 	public:
-		SystemStats();
+		explicit SystemStats(const TrackingConf& conf);
+#if _WINDOWS
+		~SystemStats();
+#endif
 
 		void start() override;
 		void stop() override;
@@ -111,6 +201,14 @@ namespace tirex {
 	private:
 		static SysInfo getSysInfo();
 		static CPUInfo getCPUInfo();
+		/**
+		 * @brief Groups the logical processors by the kind of core (see CPUInfo::CoreType).
+		 * @details On Linux, hybrid Intel CPUs are split by the PMU (`cpu_core` and `cpu_atom`) the kernel assigns to
+		 * the processors. Otherwise, they are grouped by the microarchitecture that cpuinfo detected for the core.
+		 */
+		static std::vector<CPUInfo::CoreType> getCoreTypes();
+		/** @brief Collects the information returned by getInfo(), which is cached (see tirex::utils::infocache). **/
+		static Stats collectInfo();
 	};
 } // namespace tirex
 
@@ -7,16 +7,21 @@
 #include "systemstats.hpp"
 
 #include "../../logging.hpp"
+#include "../utils/procfs.hpp"
+#include "../utils/sysfs.hpp"
 
 #include <sys/resource.h>
 #include <sys/sysinfo.h>
 #include <sys/utsname.h>
 #include <unistd.h>
 
+#include <algorithm>
 #include <cinttypes>
 #include <filesystem>
 #include <fstream>
 #include <optional>
+#include <set>
+#include <sstream>
 
 using std::chrono::steady_clock;
 
@@ -30,13 +35,23 @@ extern "C" {
 uint32_t cpuinfo_linux_get_processor_cur_frequency(uint32_t processor);
 }
 
-uint8_t SystemStats::getProcCPUUtilization() {
+namespace procfs = tirex::utils::procfs;
+namespace sysfs = tirex::utils::sysfs;
+
+SystemStats::SystemStats(const TrackingConf& conf) : sample(toSampling(conf)), pids(procfs::toPids(conf.pids)) {
+	for (auto pid : pids) {
+		pidCpuUtil.column(std::to_string(pid));
+		pidRam.column(std::to_string(pid));
+	}
+}
+
+unsigned SystemStats::getProcCPUUtilization() {
 	auto [systime, utime] = getSysAndUserTime();
 	auto time = steady_clock::now();
 	auto timeActiveMs = tickToMs(systime + utime);
 	auto totTime = std::chrono::duration_cast<std::chrono::milliseconds>(time - lastProcTime).count();
 	if (totTime != 0) {
-		auto percent = static_cast<uint8_t>((timeActiveMs - lastProcActiveMs) * 100 / totTime);
+		auto percent = static_cast<unsigned>(delta(timeActiveMs, lastProcActiveMs) * 100 / totTime);
 		lastProcTime = time;
 		lastProcActiveMs = timeActiveMs;
 		return percent;
@@ -51,19 +66,41 @@ size_t SystemStats::tickToMs(size_t tick) {
 	return (tick * 1000u) / ticksPerSec;
 }
 
+std::vector<std::vector<pid_t>> SystemStats::listTrees() const {
+	std::vector<std::vector<pid_t>> trees;
+	std::set<pid_t> listed;
+	for (auto pid : pids) {
+		auto& tree = trees.emplace_back();
+		for (auto process : procfs::listProcessTree(pid)) {
+			if (listed.insert(process).second)
+				tree.emplace_back(process);
+		}
+	}
+	return trees;
+}
+
 std::tuple<size_t, size_t> SystemStats::getSysAndUserTime() const {
-	auto pid = getpid(); /** \todo store in member **/
-	// Table 1-4 in https://www.kernel.org/doc/html/latest/filesystems/proc.html
-	auto statFile = std::filesystem::path("/") / "proc" / std::to_string(pid) / "stat";
-	auto is = std::ifstream(statFile.c_str());
-	size_t ignore, utime, stime;
-	char cignore;
-	is >> ignore;
-	// Skip filename
-	while (is && is.get() != ')')
-		;
-	is >> cignore >> ignore >> ignore >> ignore >> ignore >> ignore >> ignore >> ignore >> ignore >> ignore >> ignore >>
-			utime >> stime;
+	size_t stime = 0, utime = 0;
+	auto trees = listTrees();
+	for (size_t i = 0; i < pids.size(); ++i) {
+		auto pid = pids[i];
+		if (procfs::readStat(pid)) {
+			// The children that exited and were waited for are accounted in cstime and cutime of their parent
+			size_t treeStime = 0, treeUtime = 0;
+			for (auto process : trees[i]) {
+				if (auto stat = procfs::readStat(process); stat) {
+					treeStime += stat->stime + stat->cstime;
+					treeUtime += stat->utime + stat->cutime;
+				}
+			}
+			auto& [lastStime, lastUtime] = lastPidTimes[pid];
+			lastStime = std::max(lastStime, treeStime);
+			lastUtime = std::max(lastUtime, treeUtime);
+		}
+		auto [pidStime, pidUtime] = lastPidTimes[pid];
+		stime += pidStime;
+		utime += pidUtime;
+	}
 	return {stime, utime};
 }
 
@@ -72,14 +109,50 @@ SystemStats::SysInfo SystemStats::getSysInfo() {
 	struct sysinfo info;
 	uname(&uts);
 	sysinfo(&info);
-	return {.osname = readDistro(),
+	SysInfo sysInfo{
+			.osname = readDistro(),
 			.kerneldesc = {_fmt::format("{} {} {}", uts.sysname, uts.release, uts.machine)},
 			.architecture = uts.machine,
-			.totalRamMB = ((std::uint64_t)info.totalram * info.mem_unit) / 1000 / 1000};
+			.totalRamMB = ((std::uint64_t)info.totalram * info.mem_unit) / 1000 / 1000,
+			.numaNodes = {}
+	};
+	// https://www.kernel.org/doc/html/latest/admin-guide/mm/numaperf.html
+	for (const auto& dir : sysfs::listNumbered(sysfs::root() / "devices/system/node", "node")) {
+		// The meminfo of a node consists of lines like "Node 0 MemTotal:       32768000 kB"
+		uint64_t memoryKB = 0;
+		std::ifstream is(dir / "meminfo");
+		for (std::string line; std::getline(is, line);) {
+			if (auto pos = line.find("MemTotal:"); pos != std::string::npos)
+				memoryKB = std::strtoull(line.c_str() + pos + 9, nullptr, 10);
+		}
+		sysInfo.numaNodes.push_back(
+				{.id = static_cast<unsigned>(std::stoul(dir.filename().string().substr(4))),
+				 .processors = sysfs::readCpuList(dir / "cpulist"),
+				 .memoryMB = memoryKB * 1024 / 1000 / 1000}
+		);
+	}
+	return sysInfo;
 }
 
 void SystemStats::start() {
-	tirex::log::info("linuxstats", "Collecting resources for Process {}", getpid());
+	for (auto pid : pids)
+		tirex::log::info("linuxstats", "Collecting resources for Process {}", pid);
+	auto numProcessors = static_cast<unsigned>(sysconf(_SC_NPROCESSORS_CONF));
+	for (unsigned i = 0; i < numProcessors; ++i) {
+		coreUtil.column(_fmt::format("cpu{}", i));
+		coreFrequency.column(_fmt::format("cpu{}", i));
+	}
+	if (sample.coreTypes) {
+		auto coreTypes = getCoreTypes();
+		coreTypeOf.assign(numProcessors, coreTypes.size()); // Processors without a type are not averaged
+		for (size_t type = 0; type < coreTypes.size(); ++type) {
+			coreTypeUtil.column(coreTypes[type].label);
+			for (auto processor : coreTypes[type].processors) {
+				if (processor < coreTypeOf.size())
+					coreTypeOf[processor] = type;
+			}
+		}
+	}
 	starttime = steady_clock::now();
 	std::tie(startSysTime, startUTime) = getSysAndUserTime();
 	tirex::log::debug("linuxstats", "Start systime {} ms, utime {} ms", tickToMs(startSysTime), tickToMs(startUTime));
@@ -91,12 +164,48 @@ void SystemStats::stop() {
 }
 
 void SystemStats::step() {
+	if (!sample.any())
+		return;
 	auto utilization = getUtilization();
-	ram.addValue(utilization.ramUsedKB);
-	sysRam.addValue(utilization.system.ramUsedMB);
-	cpuUtil.addValue(utilization.cpuUtilization);
-	sysCpuUtil.addValue(utilization.system.cpuUtilization);
-	frequency.addValue(cpuinfo_linux_get_processor_cur_frequency(0));
+	if (sample.processRam) {
+		ram.addValue(utilization.ramUsedKB);
+		pidRam.addRow(std::move(utilization.pidRamUsedKB));
+	}
+	if (sample.systemRam)
+		sysRam.addValue(utilization.system.ramUsedMB);
+	if (sample.processCpu) {
+		cpuUtil.addValue(utilization.cpuUtilization);
+		pidCpuUtil.addRow(std::move(utilization.pidCpuUtilization));
+	}
+	if (sample.coreTypes) {
+		std::vector<unsigned> sums(coreTypeUtil.numColumns(), 0), counts(coreTypeUtil.numColumns(), 0);
+		const auto& cores = utilization.system.coreUtilization;
+		for (size_t core = 0; core < std::min(cores.size(), coreTypeOf.size()); ++core) {
+			if (auto type = coreTypeOf[core]; type < sums.size()) {
+				sums[type] += cores[core];
+				++counts[type];
+			}
+		}
+		for (size_t type = 0; type < sums.size(); ++type)
+			sums[type] = (counts[type] > 0) ? sums[type] / counts[type] : 0;
+		coreTypeUtil.addRow(std::move(sums));
+	}
+	if (sample.systemCpu) {
+		sysCpuUtil.addValue(utilization.system.cpuUtilization);
+		auto& cores = utilization.system.coreUtilization;
+		auto isActive = [](unsigned util) { return util >= activeCoreThreshold; };
+		activeCores.addValue(static_cast<unsigned>(std::ranges::count_if(cores, isActive)));
+		coreUtil.addRow(std::move(cores));
+	}
+	// cpufreq reports frequencies in kHz
+	if (sample.frequency)
+		frequency.addValue(cpuinfo_linux_get_processor_cur_frequency(0) / 1000);
+	if (sample.coreFrequency) {
+		std::vector<unsigned> frequencies(coreFrequency.numColumns());
+		for (uint32_t i = 0; i < frequencies.size(); ++i)
+			frequencies[i] = cpuinfo_linux_get_processor_cur_frequency(i) / 1000;
+		coreFrequency.addRow(std::move(frequencies));
+	}
 }
 
 std::optional<std::string> readDistroFromLSB() {
@@ -139,64 +248,103 @@ std::string readDistro() {
 }
 
 SystemStats::Utilization SystemStats::getUtilization() {
-	Utilization utilization;
-	auto pid = getpid();
-	parseStat(utilization);
-	parseStatm(pid, utilization);
-
-	struct sysinfo info;
-	sysinfo(&info);
-	utilization.system.ramUsedMB =
-			((std::uint64_t)(info.totalram - info.freeram - info.bufferram - info.freehigh) * info.mem_unit) / 1000 /
-			1000;
+	Utilization utilization{};
+	// Only the files that are needed for the sampled series are parsed
+	if (sample.systemCpu || sample.coreTypes)
+		parseStat(utilization);
+	if (sample.processRam)
+		parseStatm(utilization);
+	if (sample.systemRam)
+		parseMemInfo(utilization);
+	if (!sample.processCpu)
+		return utilization;
+	// The per-process utilization has to be computed before getProcCPUUtilization() updates lastProcTime
+	auto elapsedMs = std::chrono::duration_cast<std::chrono::milliseconds>(steady_clock::now() - lastProcTime).count();
 	utilization.cpuUtilization = getProcCPUUtilization();
+	lastPidActiveMs.resize(pids.size(), 0);
+	for (size_t i = 0; i < pids.size(); ++i) {
+		auto [stime, utime] = lastPidTimes[pids[i]]; // Updated by getProcCPUUtilization()
+		auto activeMs = tickToMs(stime + utime);
+		auto percent = (elapsedMs > 0) ? delta(activeMs, lastPidActiveMs[i]) * 100 / elapsedMs : 0;
+		utilization.pidCpuUtilization.emplace_back(static_cast<unsigned>(percent));
+		lastPidActiveMs[i] = activeMs;
+	}
 
 	return utilization;
 }
 
 void SystemStats::parseMemInfo(Utilization& utilization) {
-	auto file = std::filesystem::path("/") / "proc" / "meminfo";
-	auto is = std::ifstream(file.c_str());
-	std::string key;
-
-	while (is) {
-		is >> key;
-		if (key == "MemTotal:") {
-
-		} else {
-			std::getline(is, key); // Write to key to throw away
-		}
-	}
-	/** \todo: memory used = MemTotal - MemFree - Buffers - Cached - SReclaimable **/
+	// Section 1.7 in https://www.kernel.org/doc/html/latest/filesystems/proc.html (all values are in kB)
+	auto meminfo = procfs::readFields("/proc/meminfo");
+	auto get = [&meminfo](const char* key) -> uint64_t {
+		auto it = meminfo.find(key);
+		return (it != meminfo.end()) ? it->second : 0;
+	};
+	// Like free(1), we do not count buffers and the (reclaimable) page cache as used memory
+	auto total = get("MemTotal");
+	auto unused = get("MemFree") + get("Buffers") + get("Cached") + get("SReclaimable");
+	auto usedKB = (total > unused) ? (total - unused) : 0;
+	utilization.system.ramUsedMB = static_cast<unsigned>(usedKB * 1024 / 1000 / 1000);
 }
 
 void SystemStats::parseStat(Utilization& utilization) {
 	// Section 1.7 in https://www.kernel.org/doc/html/latest/filesystems/proc.html
 	auto statFile = std::filesystem::path("/") / "proc" / "stat";
 	auto is = std::ifstream(statFile.c_str());
-	std::string cpu;
-	size_t user, nice, system, idle, iowait, irq, softirq, steal, guest, guestnice;
-	is >> cpu >> user >> nice >> system >> idle >> iowait >> irq >> softirq >> steal >> guest >> guestnice;
-
-	auto total = user + nice + system + idle + iowait + irq + softirq + steal + guest + guestnice;
-	if (total - lastTotal == 0) {
-		// Not enough time has passed
-		utilization.system.cpuUtilization = 100;
-	} else {
-		utilization.system.cpuUtilization = 100 - (((idle - lastIdle) * 100) / (total - lastTotal));
+	auto& cores = utilization.system.coreUtilization;
+	cores = lastCoreUtilization; // Cores for which no time passed repeat their last utilization
+	cores.resize(coreUtil.numColumns(), 0);
+	// The aggregate "cpu" line is followed by one "cpuN" line per online logical core
+	for (std::string line; std::getline(is, line) && line.starts_with("cpu");) {
+		std::istringstream fields(line);
+		std::string cpu;
+		size_t user, nice, system, idle, iowait, irq, softirq, steal, guest, guestnice;
+		fields >> cpu >> user >> nice >> system >> idle >> iowait >> irq >> softirq >> steal >> guest >> guestnice;
+		auto total = user + nice + system + idle + iowait + irq + softirq + steal + guest + guestnice;
 
-		lastIdle = idle;
-		lastTotal = total;
+		if (cpu == "cpu") {
+			// If not enough time has passed, the last utilization is repeated
+			if (total - lastTotal != 0) {
+				lastCpuUtilization = static_cast<uint8_t>(100 - (((idle - lastIdle) * 100) / (total - lastTotal)));
+				lastIdle = idle;
+				lastTotal = total;
+			}
+			utilization.system.cpuUtilization = lastCpuUtilization;
+		} else {
+			auto core = std::stoul(cpu.substr(3));
+			if (core >= lastCoreTotal.size()) {
+				lastCoreIdle.resize(core + 1, 0);
+				lastCoreTotal.resize(core + 1, 0);
+			}
+			if (core >= cores.size())
+				cores.resize(core + 1, 0);
+			if (total - lastCoreTotal[core] != 0) {
+				cores[core] = static_cast<unsigned>(
+						100 - (((idle - lastCoreIdle[core]) * 100) / (total - lastCoreTotal[core]))
+				);
+				lastCoreIdle[core] = idle;
+				lastCoreTotal[core] = total;
+			}
+		}
 	}
+	lastCoreUtilization = cores;
 }
 
-void SystemStats::parseStatm(pid_t pid, Utilization& utilization) {
-	// Table 1-3 in https://www.kernel.org/doc/html/latest/filesystems/proc.html
-	auto statFile = std::filesystem::path("/") / "proc" / std::to_string(pid) / "statm";
-	auto is = std::ifstream(statFile.c_str());
-	size_t ignore, resident;
-	is >> ignore >> resident;
-	utilization.ramUsedKB = (resident * getpagesize()) / 1000;
+void SystemStats::parseStatm(Utilization& utilization) {
+	utilization.ramUsedKB = 0;
+	for (const auto& tree : listTrees()) {
+		size_t resident = 0;
+		for (auto process : tree) {
+			// Table 1-3 in https://www.kernel.org/doc/html/latest/filesystems/proc.html
+			auto is = std::ifstream(procfs::pidPath(process) / "statm");
+			size_t ignore, pages = 0; // Processes that already exited do not use any memory
+			is >> ignore >> pages;
+			resident += pages;
+		}
+		auto usedKB = static_cast<unsigned>((resident * getpagesize()) / 1000);
+		utilization.pidRamUsedKB.emplace_back(usedKB);
+		utilization.ramUsedKB += usedKB;
+	}
 }
 
 #endif
\ No newline at end of file
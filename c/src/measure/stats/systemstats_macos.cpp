@@ -29,12 +29,18 @@ static std::string getKernelDesc() {
 	return _fmt::format("{} {}", getSysctl<std::string>("kern.ostype"), getSysctl<std::string>("kern.osrelease"));
 }
 
-uint8_t SystemStats::getProcCPUUtilization() {
+SystemStats::SystemStats(const TrackingConf& conf)
+		: sample(toSampling(conf)), pid(conf.pids.empty() ? getpid() : static_cast<pid_t>(conf.pids.front())) {
+	if (conf.pids.size() > 1)
+		tirex::log::warn("macosstats", "Only the first of {} processes is tracked on this platform", conf.pids.size());
+}
+
+unsigned SystemStats::getProcCPUUtilization() {
 	auto [systime, utime] = getSysAndUserTime();
 	auto time = steady_clock::now();
 	auto timeActiveMs = tickToMs(systime + utime);
-	auto percent = static_cast<uint8_t>(
-			(timeActiveMs - lastProcActiveMs) * 100 /
+	auto percent = static_cast<unsigned>(
+			delta(timeActiveMs, lastProcActiveMs) * 100 /
 			std::chrono::duration_cast<std::chrono::milliseconds>(time - lastProcTime).count()
 	);
 	lastProcTime = time;
@@ -66,7 +72,6 @@ uint8_t SystemStats::getCPUUtilization() {
 }
 
 std::tuple<size_t, size_t> SystemStats::getSysAndUserTime() const {
-	auto pid = getpid(); /** \todo store in member **/
 	proc_taskinfo taskInfo;
 	if (int err; (err = proc_pidinfo(pid, PROC_PIDTASKINFO, 0, &taskInfo, PROC_PIDTASKINFO_SIZE)) != 0) {
 		return {taskInfo.pti_total_system, taskInfo.pti_total_user};
@@ -107,7 +112,6 @@ static unsigned getSystemRAMUsageMB() {
 }
 
 SystemStats::Utilization SystemStats::getUtilization() {
-	auto pid = getpid(); /** \todo store in member **/
 	return Utilization{
 			.ramUsedKB = getRAMUsageKB(pid),
 			.cpuUtilization = getProcCPUUtilization(),
@@ -125,7 +129,7 @@ SystemStats::SysInfo SystemStats::getSysInfo() {
 #include <dlfcn.h>
 
 void SystemStats::start() {
-	tirex::log::info("macosstats", "Collecting resources for Process {}", getpid());
+	tirex::log::info("macosstats", "Collecting resources for Process {}", pid);
 	starttime = steady_clock::now();
 	std::tie(startSysTime, startUTime) = getSysAndUserTime();
 	tirex::log::debug("macosstats", "Start systime {} ms, utime {} ms", tickToMs(startSysTime), tickToMs(startUTime));
@@ -177,6 +181,8 @@ void SystemStats::stop() {
 }
 
 void SystemStats::step() {
+	if (!sample.any())
+		return;
 	auto utilization = getUtilization();
 	ram.addValue(utilization.ramUsedKB);
 	sysRam.addValue(utilization.system.ramUsedMB);
@@ -111,14 +111,33 @@ static void getProcessorFrequencies(std::vector<uint32_t>& freq) {
 		freq[i] = data[i].CurrentMhz;
 }
 
+SystemStats::SystemStats(const TrackingConf& conf) : sample(toSampling(conf)), process(GetCurrentProcess()) {
+	if (conf.pids.size() > 1) {
+		tirex::log::warn(
+				"windowsstats", "Only the first of {} processes is tracked on this platform", conf.pids.size()
+		);
+	}
+	if (!conf.pids.empty()) {
+		// tirexStartTrackingPids checked that the process can be opened. If it exited since, its usage is reported as
+		// 0 instead of the usage of the calling process.
+		auto access = PROCESS_QUERY_LIMITED_INFORMATION | PROCESS_VM_READ;
+		process = OpenProcess(access, FALSE, conf.pids.front());
+		if (process == nullptr)
+			tirex::log::error("windowsstats", "Failed to open process {}", conf.pids.front());
+	}
+}
+SystemStats::~SystemStats() {
+	if (process != nullptr)
+		CloseHandle(process);
+}
+
 static uint64_t fileTimeToUint64(const FILETIME& ft) {
 	return (static_cast<uint64_t>(ft.dwHighDateTime) << 32) | static_cast<uint64_t>(ft.dwLowDateTime);
 }
 
 std::tuple<size_t, size_t> SystemStats::getSysAndUserTime() const {
-	HANDLE pid = GetCurrentProcess(); /** \todo move this into a member variable **/
 	FILETIME creationTime, exitTime, kernelTime, userTime;
-	if (GetProcessTimes(pid, &creationTime, &exitTime, &kernelTime, &userTime)) {
+	if (GetProcessTimes(process, &creationTime, &exitTime, &kernelTime, &userTime)) {
 		return {fileTimeToUint64(kernelTime), fileTimeToUint64(userTime)};
 	} else {
 		tirex::log::error("windowstats", "Failed to get process times");
@@ -180,8 +199,7 @@ uint8_t SystemStats::getCPUUtilization() {
 	return util;
 }
 
-uint8_t SystemStats::getProcCPUUtilization() {
-	HANDLE pid = GetCurrentProcess(); /** \todo store in member **/
+unsigned SystemStats::getProcCPUUtilization() {
 	FILETIME ftime, fsys, fuser;
 	ULARGE_INTEGER now, sys, user;
 	size_t percent;
@@ -189,7 +207,7 @@ uint8_t SystemStats::getProcCPUUtilization() {
 	GetSystemTimeAsFileTime(&ftime);
 	memcpy(&now, &ftime, sizeof(FILETIME));
 
-	GetProcessTimes(pid, &ftime, &ftime, &fsys, &fuser);
+	GetProcessTimes(process, &ftime, &ftime, &fsys, &fuser);
 	memcpy(&sys, &fsys, sizeof(FILETIME));
 	memcpy(&user, &fuser, sizeof(FILETIME));
 	percent = (sys.QuadPart - lastSysCPU.QuadPart) + (user.QuadPart - lastUserCPU.QuadPart);
@@ -199,13 +217,12 @@ uint8_t SystemStats::getProcCPUUtilization() {
 	lastCPU = now;
 	lastUserCPU = user;
 	lastSysCPU = sys;
-	return static_cast<uint8_t>(percent);
+	return static_cast<unsigned>(percent);
 }
 
 SystemStats::Utilization SystemStats::getUtilization() {
-	HANDLE pid = GetCurrentProcess(); /** \todo store in member **/
 	return Utilization{
-			.ramUsedKB = getRAMUsageKB(pid),
+			.ramUsedKB = getRAMUsageKB(process),
 			.cpuUtilization = getProcCPUUtilization(),
 			.system = {.ramUsedMB = getSystemRAMUsageMB(), .cpuUtilization = getCPUUtilization()}
 	};
@@ -227,12 +244,16 @@ void SystemStats::start() {
 	SYSTEM_INFO sysInfo;
 	GetSystemInfo(&sysInfo);
 	numProcessors = sysInfo.dwNumberOfProcessors;
+	for (unsigned i = 0; i < numProcessors; ++i)
+		coreFrequency.column(_fmt::format("cpu{}", i));
 }
 void SystemStats::stop() {
 	stoptime = steady_clock::now();
 	std::tie(stopSysTime, stopUTime) = getSysAndUserTime();
 }
 void SystemStats::step() {
+	if (!sample.any())
+		return;
 	thread_local static std::vector<uint32_t> cpuFreqs;
 	getProcessorFrequencies(cpuFreqs);
 
@@ -242,5 +263,6 @@ void SystemStats::step() {
 	cpuUtil.addValue(utilization.cpuUtilization);
 	sysCpuUtil.addValue(utilization.system.cpuUtilization);
 	frequency.addValue(cpuFreqs[0]);
+	coreFrequency.addRow({cpuFreqs.begin(), cpuFreqs.end()});
 }
 #endif
\ No newline at end of file
@@ -0,0 +1,184 @@
+#include "thermalstats.hpp"
+
+#include "../../logging.hpp"
+#include "../utils/rangeutils.hpp"
+#include "../utils/sysfs.hpp"
+
+#include <algorithm>
+#include <cstdlib>
+#include <set>
+#include <utility>
+
+using std::chrono::steady_clock;
+
+using tirex::Stats;
+using tirex::ThermalStats;
+
+const char* ThermalStats::version = nullptr;
+const std::set<tirexMeasure> ThermalStats::measures{
+		TIREX_CPU_IDLE_STATES, TIREX_CPU_IDLE_PERCENT, TIREX_CPU_THROTTLE_EVENTS, TIREX_THERMAL_ZONES_CELSIUS
+};
+
+#if __linux__
+namespace sysfs = tirex::utils::sysfs;
+
+static uint64_t delta(uint64_t stop, uint64_t start) { return (stop > start) ? (stop - start) : 0; }
+
+ThermalStats::ThermalStats(const TrackingConf& conf) {
+	if (auto env = std::getenv("TIREX_THERMAL_STEP_INTERVAL");
+		env != nullptr && conf.requested({TIREX_CPU_IDLE_PERCENT, TIREX_THERMAL_ZONES_CELSIUS}))
+		stepInterval = std::strtoul(env, nullptr, 10);
+
+	// Statistics whose measures were not requested are not discovered and thus never read
+	// https://docs.kernel.org/admin-guide/pm/cpuidle.html
+	cpus = sysfs::listNumbered(sysfs::root() / "devices" / "system" / "cpu", "cpu");
+	if (!cpus.empty() && conf.requested({TIREX_CPU_IDLE_STATES, TIREX_CPU_IDLE_PERCENT})) {
+		for (const auto& state : sysfs::listNumbered(cpus.front() / "cpuidle", "state"))
+			idleStates.emplace_back(sysfs::readString(state / "name").value_or(state.filename().string()));
+	}
+	// https://docs.kernel.org/arch/x86/topology.html; the throttle counters are shared by all CPUs of a core (package)
+	if (conf.requested({TIREX_CPU_THROTTLE_EVENTS})) {
+		std::set<std::pair<uint64_t, uint64_t>> cores;
+		std::set<uint64_t> packages;
+		for (const auto& cpu : cpus) {
+			if (!std::filesystem::exists(cpu / "thermal_throttle"))
+				continue;
+			auto package = sysfs::readUint(cpu / "topology" / "physical_package_id").value_or(0);
+			auto core = sysfs::readUint(cpu / "topology" / "core_id").value_or(0);
+			if (cores.emplace(package, core).second)
+				coreThrottleDirs.emplace_back(cpu / "thermal_throttle");
+			if (packages.emplace(package).second)
+				packageThrottleDirs.emplace_back(cpu / "thermal_throttle");
+		}
+	}
+	// https://docs.kernel.org/driver-api/thermal/sysfs-api.html
+	if (conf.requested({TIREX_THERMAL_ZONES_CELSIUS})) {
+		for (const auto& zone : sysfs::listNumbered(sysfs::root() / "class" / "thermal", "thermal_zone"))
+			zones.emplace_back(zone.filename().string(), sysfs::readString(zone / "type").value_or("unknown"), zone);
+	}
+
+	if (idleStates.empty() && coreThrottleDirs.empty() && zones.empty()) {
+		tirex::log::warn(
+				"thermalstats", "Found neither CPU idle states nor thermal statistics in {}", sysfs::root().string()
+		);
+	}
+}
+
+ThermalStats::Snapshot ThermalStats::takeSnapshot() const {
+	Snapshot snapshot{
+			.time = steady_clock::now(),
+			.idleTimeUs = std::vector<uint64_t>(idleStates.size(), 0),
+			.idleUsage = std::vector<uint64_t>(idleStates.size(), 0),
+			.coreThrottles = 0,
+			.packageThrottles = 0,
+			.coreThrottleMs = 0,
+			.packageThrottleMs = 0,
+			.temperatures = {}
+	};
+	for (const auto& cpu : cpus) {
+		for (size_t i = 0; i < idleStates.size(); ++i) {
+			auto state = cpu / "cpuidle" / ("state" + std::to_string(i));
+			snapshot.idleTimeUs[i] += sysfs::readUint(state / "time").value_or(0);
+			snapshot.idleUsage[i] += sysfs::readUint(state / "usage").value_or(0);
+		}
+	}
+	for (const auto& dir : coreThrottleDirs) {
+		snapshot.coreThrottles += sysfs::readUint(dir / "core_throttle_count").value_or(0);
+		snapshot.coreThrottleMs += sysfs::readUint(dir / "core_throttle_total_time_ms").value_or(0);
+	}
+	for (const auto& dir : packageThrottleDirs) {
+		snapshot.packageThrottles += sysfs::readUint(dir / "package_throttle_count").value_or(0);
+		snapshot.packageThrottleMs += sysfs::readUint(dir / "package_throttle_total_time_ms").value_or(0);
+	}
+	for (const auto& zone : zones) {
+		// The temperature is reported in millidegree Celsius
+		auto temp = sysfs::readInt(zone.path / "temp");
+		snapshot.temperatures.emplace_back(temp ? std::optional(*temp / 1000.0) : std::nullopt);
+	}
+	return snapshot;
+}
+
+void ThermalStats::updateMaxTemperatures(const Snapshot& snapshot) {
+	maxTemperatures.resize(snapshot.temperatures.size());
+	for (size_t i = 0; i < snapshot.temperatures.size(); ++i) {
+		if (snapshot.temperatures[i] && (!maxTemperatures[i] || *maxTemperatures[i] < *snapshot.temperatures[i]))
+			maxTemperatures[i] = snapshot.temperatures[i];
+	}
+}
+
+void ThermalStats::start() {
+	startSnapshot = lastSnapshot = takeSnapshot();
+	updateMaxTemperatures(startSnapshot);
+}
+void ThermalStats::stop() {
+	stopSnapshot = takeSnapshot();
+	updateMaxTemperatures(stopSnapshot);
+}
+void ThermalStats::step() {
+	if (stepInterval == 0 || (++numSteps % stepInterval) != 0)
+		return;
+	auto snapshot = takeSnapshot();
+	updateMaxTemperatures(snapshot);
+	if (!idleStates.empty()) {
+		uint64_t idleUs = 0;
+		for (size_t i = 0; i < idleStates.size(); ++i)
+			idleUs += delta(snapshot.idleTimeUs[i], lastSnapshot.idleTimeUs[i]);
+		auto elapsedUs = std::chrono::duration_cast<std::chrono::microseconds>(snapshot.time - lastSnapshot.time);
+		auto totalUs = static_cast<uint64_t>(elapsedUs.count()) * cpus.size();
+		idlePercent.addValue(
+				static_cast<unsigned>((totalUs != 0) ? std::min<uint64_t>(idleUs * 100 / totalUs, 100) : 0)
+		);
+	}
+	lastSnapshot = std::move(snapshot);
+}
+
+Stats ThermalStats::getStats() {
+	auto elapsedUs = std::chrono::duration_cast<std::chrono::microseconds>(stopSnapshot.time - startSnapshot.time);
+	auto totalUs = static_cast<double>(elapsedUs.count()) * static_cast<double>(cpus.size());
+	std::vector<std::string> states;
+	for (size_t i = 0; i < idleStates.size(); ++i) {
+		auto timeUs = delta(stopSnapshot.idleTimeUs[i], startSnapshot.idleTimeUs[i]);
+		states.emplace_back(_fmt::format(
+				"{}: {{residency_percent: {:.2f}, entries: {}}}", idleStates[i],
+				(totalUs > 0) ? static_cast<double>(timeUs) * 100 / totalUs : 0.0,
+				delta(stopSnapshot.idleUsage[i], startSnapshot.idleUsage[i])
+		));
+	}
+	auto throttling = _fmt::format(
+			"{{core: {}, package: {}, core_ms: {}, package_ms: {}}}",
+			delta(stopSnapshot.coreThrottles, startSnapshot.coreThrottles),
+			delta(stopSnapshot.packageThrottles, startSnapshot.packageThrottles),
+			delta(stopSnapshot.coreThrottleMs, startSnapshot.coreThrottleMs),
+			delta(stopSnapshot.packageThrottleMs, startSnapshot.packageThrottleMs)
+	);
+	auto toStr = [](const std::optional<double>& temp) {
+		return temp ? _fmt::format("{:.1f}", *temp) : std::string("null");
+	};
+	std::vector<std::string> temperatures;
+	for (size_t i = 0; i < zones.size(); ++i) {
+		temperatures.emplace_back(_fmt::format(
+				"{}: {{type: {}, start: {}, stop: {}, max: {}}}", zones[i].name, zones[i].type,
+				toStr(startSnapshot.temperatures[i]), toStr(stopSnapshot.temperatures[i]), toStr(maxTemperatures[i])
+		));
+	}
+	Stats stats{
+			{TIREX_CPU_IDLE_STATES, "{" + tirex::utils::join(states, ',') + "}"},
+			{TIREX_CPU_THROTTLE_EVENTS, throttling},
+			{TIREX_THERMAL_ZONES_CELSIUS, "{" + tirex::utils::join(temperatures, ',') + "}"}
+	};
+	if (stepInterval != 0 && !idleStates.empty())
+		stats.insert({TIREX_CPU_IDLE_PERCENT, idlePercent});
+	return stats;
+}
+#else
+ThermalStats::ThermalStats(const TrackingConf&) {
+	tirex::log::warn("thermalstats", "CPU idle and thermal statistics are not supported on this platform");
+}
+
+ThermalStats::Snapshot ThermalStats::takeSnapshot() const { return {}; }
+void ThermalStats::updateMaxTemperatures(const Snapshot&) {}
+void ThermalStats::start() {}
+void ThermalStats::stop() {}
+void ThermalStats::step() {}
+Stats ThermalStats::getStats() { return {}; }
+#endif
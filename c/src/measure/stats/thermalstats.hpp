@@ -0,0 +1,75 @@
+#ifndef STATS_THERMALSTATS_HPP
+#define STATS_THERMALSTATS_HPP
+
+#include "../measure.hpp"
+#include "provider.hpp"
+
+#include <chrono>
+#include <cstdint>
+#include <filesystem>
+#include <optional>
+#include <string>
+#include <vector>
+
+namespace tirex {
+	/**
+	 * @brief Collects how much time the CPUs spent in each idle state (C-state), how often they were throttled due to
+	 * their temperature and the temperature of each thermal zone, which helps to explain variance between runs.
+	 * @details Currently, only Linux is supported, where the statistics are read from
+	 * `/sys/devices/system/cpu/cpu<N>/cpuidle/`, `/sys/devices/system/cpu/cpu<N>/thermal_throttle/` and
+	 * `/sys/class/thermal/`. The statistics are sampled when tracking starts and stops and, if
+	 * `TIREX_THERMAL_STEP_INTERVAL` is set to some N > 0, every N-th polling step. Only the statistics that the
+	 * requested measures need are read. The sysfs root can be overridden by setting `TIREX_SYSFS_ROOT`.
+	 */
+	class ThermalStats final : public StatsProvider {
+	private:
+		struct Snapshot {
+			std::chrono::steady_clock::time_point time;
+			std::vector<uint64_t> idleTimeUs; /**< The time spent in each idle state summed over all CPUs (in µs) **/
+			std::vector<uint64_t> idleUsage;  /**< How often each idle state was entered summed over all CPUs **/
+			uint64_t coreThrottles = 0;
+			uint64_t packageThrottles = 0;
+			uint64_t coreThrottleMs = 0;
+			uint64_t packageThrottleMs = 0;
+			std::vector<std::optional<double>> temperatures; /**< The temperature of each thermal zone in °C **/
+		};
+		struct Zone {
+			std::string name; /**< The name of the zone's directory (e.g., thermal_zone0) **/
+			std::string type; /**< The type of the zone (e.g., x86_pkg_temp) **/
+			std::filesystem::path path;
+		};
+
+		std::vector<std::filesystem::path> cpus;
+		std::vector<std::string> idleStates; /**< The names of the idle states of the first CPU **/
+		/** The `thermal_throttle` directory of a single CPU per physical core (the counters are shared by siblings) **/
+		std::vector<std::filesystem::path> coreThrottleDirs;
+		/** The `thermal_throttle` directory of a single CPU per package (the counters are shared by all its CPUs) **/
+		std::vector<std::filesystem::path> packageThrottleDirs;
+		std::vector<Zone> zones;
+
+		size_t stepInterval = 0; /**< Sample the statistics every n-th step (0 = only at start and stop) **/
+		size_t numSteps = 0;
+		Snapshot startSnapshot;
+		Snapshot lastSnapshot;
+		Snapshot stopSnapshot;
+		std::vector<std::optional<double>> maxTemperatures;
+		tirex::TimeSeries<unsigned> idlePercent{true};
+
+		Snapshot takeSnapshot() const;
+		void updateMaxTemperatures(const Snapshot& snapshot);
+
+	public:
+		explicit ThermalStats(const TrackingConf& conf);
+
+		void start() override;
+		void stop() override;
+		void step() override;
+		Stats getStats() override;
+
+		static constexpr const char* description = "Collects CPU idle state residency, throttling and temperatures.";
+		static const char* version;
+		static const std::set<tirexMeasure> measures;
+	};
+} // namespace tirex
+
+#endif
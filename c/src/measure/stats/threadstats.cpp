@@ -0,0 +1,131 @@
+#include "threadstats.hpp"
+
+#include "../../logging.hpp"
+#include "../utils/procfs.hpp"
+#include "../utils/rangeutils.hpp"
+
+#include <algorithm>
+#include <string>
+
+#if __linux__
+#include <unistd.h>
+#endif
+
+using std::chrono::steady_clock;
+
+using tirex::Stats;
+using tirex::ThreadStats;
+
+const char* ThreadStats::version = nullptr;
+const std::set<tirexMeasure> ThreadStats::measures{
+		TIREX_CPU_NUM_THREADS_PROCESS, TIREX_CPU_USED_THREADS_PERCENT, TIREX_CPU_TIME_THREADS_MS,
+		TIREX_CPU_THREADS_IMBALANCE
+};
+
+#if __linux__
+namespace procfs = tirex::utils::procfs;
+
+ThreadStats::ThreadStats(const TrackingConf& conf)
+		: pids(procfs::toPids(conf.pids)),
+		  perThread(conf.requested(
+				  {TIREX_CPU_USED_THREADS_PERCENT, TIREX_CPU_TIME_THREADS_MS, TIREX_CPU_THREADS_IMBALANCE}
+		  )) {}
+
+size_t ThreadStats::update(std::vector<unsigned>* row, bool initial) {
+	auto now = steady_clock::now();
+	auto elapsedMs = std::chrono::duration_cast<std::chrono::milliseconds>(now - lastStep).count();
+	lastStep = now;
+
+	size_t alive = 0;
+	for (auto process : procfs::listProcessTree(pids)) {
+		for (auto tid : procfs::listTasks(process)) {
+			if (tid == monitorTid)
+				continue;
+			if (!perThread) {
+				++alive;
+				continue;
+			}
+			auto stat = procfs::readStat(process, tid);
+			if (!stat)
+				continue; // The thread exited in the meantime
+			++alive;
+			auto time = stat->utime + stat->stime;
+			auto [it, inserted] = threads.try_emplace(tid);
+			auto& thread = it->second;
+			if (inserted) {
+				thread.column = threadUtil.column(std::to_string(tid));
+				// Threads that already exist when tracking starts only count the time spent from then on
+				thread.startTime = thread.lastTime = initial ? time : 0;
+			} else if (time < thread.lastTime) {
+				// The thread ID was reused by a new thread, so we keep what its predecessor accumulated
+				thread.reusedTime += thread.lastTime - thread.startTime;
+				thread.startTime = thread.lastTime = 0;
+			}
+			if (row != nullptr && elapsedMs > 0) {
+				if (row->size() <= thread.column)
+					row->resize(thread.column + 1);
+				auto activeMs = procfs::ticksToMs(time - thread.lastTime);
+				(*row)[thread.column] = static_cast<unsigned>(activeMs * 100 / elapsedMs);
+			}
+			thread.lastTime = time;
+		}
+	}
+	return alive;
+}
+
+void ThreadStats::start() {
+	tirex::log::info(
+			"threadstats", "Collecting per-thread statistics for {} process(es) and their children", pids.size()
+	);
+	if (perThread)
+		update(nullptr, true);
+}
+void ThreadStats::stop() {
+	if (perThread)
+		update(nullptr);
+}
+void ThreadStats::step() {
+	if (monitorTid == 0)
+		monitorTid = gettid();
+	std::vector<unsigned> row(threadUtil.numColumns());
+	numThreads.addValue(static_cast<unsigned>(update(&row)));
+	if (perThread)
+		threadUtil.addRow(std::move(row));
+}
+
+Stats ThreadStats::getStats() {
+	if (!perThread)
+		return {{TIREX_CPU_NUM_THREADS_PROCESS, numThreads}};
+	std::vector<std::string> times;
+	uint64_t maxMs = 0, sumMs = 0;
+	size_t active = 0;
+	for (const auto& [tid, thread] : threads) {
+		auto ms = procfs::ticksToMs(thread.reusedTime + thread.lastTime - thread.startTime);
+		times.emplace_back(_fmt::format("{}: {}", tid, ms));
+		if (ms > 0) {
+			++active;
+			sumMs += ms;
+			maxMs = std::max(maxMs, ms);
+		}
+	}
+	// The imbalance is the ratio between the busiest thread and the average active thread (1 = perfectly balanced)
+	auto meanMs = (active != 0) ? static_cast<double>(sumMs) / active : 0.0;
+	auto imbalance = _fmt::format(
+			"{{threads: {}, active: {}, max_ms: {}, mean_ms: {:.1f}, imbalance: {:.2f}}}", threads.size(), active,
+			maxMs, meanMs, (active != 0) ? maxMs / meanMs : 0.0
+	);
+	return {{TIREX_CPU_NUM_THREADS_PROCESS, numThreads},
+			{TIREX_CPU_USED_THREADS_PERCENT, threadUtil},
+			{TIREX_CPU_TIME_THREADS_MS, "{" + tirex::utils::join(times, ',') + "}"},
+			{TIREX_CPU_THREADS_IMBALANCE, imbalance}};
+}
+#else
+ThreadStats::ThreadStats(const TrackingConf&) {
+	tirex::log::warn("threadstats", "Per-thread statistics are not supported on this platform");
+}
+
+void ThreadStats::start() {}
+void ThreadStats::stop() {}
+void ThreadStats::step() {}
+Stats ThreadStats::getStats() { return {}; }
+#endif
\ No newline at end of file
@@ -0,0 +1,64 @@
+#ifndef STATS_THREADSTATS_HPP
+#define STATS_THREADSTATS_HPP
+
+#include "../measure.hpp"
+#include "provider.hpp"
+
+#include <chrono>
+#include <map>
+#include <vector>
+
+#if __linux__
+#include <sys/types.h>
+#endif
+
+namespace tirex {
+	/**
+	 * @brief Collects per-thread CPU utilization of the tracked processes and all of their children.
+	 * @details Currently, only Linux is supported, where the statistics are read from `/proc/<pid>/task/<tid>/stat`.
+	 */
+	class ThreadStats final : public StatsProvider {
+	private:
+		tirex::TimeSeries<unsigned> numThreads{true};
+		tirex::TimeSeriesMatrix<unsigned> threadUtil;
+
+#if __linux__
+		struct Thread {
+			size_t column;		 /**< The column of the thread in ThreadStats::threadUtil **/
+			uint64_t startTime;	 /**< CPU time (in clock ticks) that the thread had spent before tracking started **/
+			uint64_t lastTime;	 /**< CPU time (in clock ticks) that the thread had spent at the last step **/
+			uint64_t reusedTime; /**< CPU time (in clock ticks) of exited threads that had the same ID before **/
+		};
+		std::vector<pid_t> pids;
+		/** Whether any of the per-thread measures was requested, otherwise the threads are only counted **/
+		const bool perThread;
+		pid_t monitorTid = 0; /**< The thread calling step(), which should not be accounted to the tracked process **/
+		std::map<pid_t, Thread> threads;
+		std::chrono::steady_clock::time_point lastStep;
+
+		/**
+		 * @brief Reads the CPU time of all threads of the tracked process tree (if ThreadStats::perThread is set) and
+		 * updates the bookkeeping.
+		 * @param row If not null, the utilization (in percent of a single core) of each thread since the last call is
+		 * written to the thread's column.
+		 * @param initial If true, the CPU time threads have spent up until now is not accounted to the tracked period.
+		 * @return the number of threads that are currently alive.
+		 */
+		size_t update(std::vector<unsigned>* row, bool initial = false);
+#endif
+
+	public:
+		explicit ThreadStats(const TrackingConf& conf);
+
+		void start() override;
+		void stop() override;
+		void step() override;
+		Stats getStats() override;
+
+		static constexpr const char* description = "Collects per-thread CPU utilization metrics.";
+		static const char* version;
+		static const std::set<tirexMeasure> measures;
+	};
+} // namespace tirex
+
+#endif
\ No newline at end of file
@@ -0,0 +1,186 @@
+#ifndef MEASURE_UTILS_AMDGPU_HPP
+#define MEASURE_UTILS_AMDGPU_HPP
+
+#if defined(__linux__)
+
+#include "procfs.hpp"
+#include "sysfs.hpp"
+
+#include <algorithm>
+#include <charconv>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <map>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <sys/types.h>
+
+/**
+ * @brief Reads the metrics of AMD GPUs from the sysfs interface of the amdgpu driver.
+ * @details https://docs.kernel.org/gpu/amdgpu/driver-misc.html and https://docs.kernel.org/gpu/amdgpu/thermal.html.
+ * All paths are relative to tirex::utils::sysfs::root(), such that they can be tested against fixture directories.
+ */
+namespace tirex::utils::amdgpu {
+	struct Card {
+		std::string name;			   /**< The name of the DRM card (e.g., card1) **/
+		std::filesystem::path device;  /**< The `device` directory of the card **/
+		std::filesystem::path hwmon;   /**< The hwmon directory of the card (empty if there is none) **/
+		std::string pciAddress;		   /**< The PCI address (e.g., 0000:03:00.0) to match the DRM clients **/
+	};
+
+	/**
+	 * @brief Lists the DRM cards (`/sys/class/drm/card<N>`) that are driven by amdgpu.
+	 */
+	inline std::vector<Card> listCards() {
+		std::vector<Card> cards;
+		for (const auto& dir : sysfs::listNumbered(sysfs::root() / "class/drm", "card")) {
+			auto device = dir / "device";
+			// The driver symlink points to .../drivers/amdgpu
+			std::error_code ec;
+			auto driver = std::filesystem::read_symlink(device / "driver", ec);
+			if (ec || driver.filename() != "amdgpu")
+				continue;
+			Card card{.name = dir.filename().string(), .device = device, .hwmon = {}, .pciAddress = {}};
+			if (auto hwmons = sysfs::listNumbered(device / "hwmon", "hwmon"); !hwmons.empty())
+				card.hwmon = hwmons.front();
+			std::ifstream is(device / "uevent");
+			for (std::string line; std::getline(is, line);) {
+				if (line.starts_with("PCI_SLOT_NAME="))
+					card.pciAddress = line.substr(line.find('=') + 1);
+			}
+			cards.emplace_back(std::move(card));
+		}
+		return cards;
+	}
+
+	/**
+	 * @brief Returns a human readable name of the card: the product name if the board provides it and the PCI vendor
+	 * and device ID otherwise.
+	 */
+	inline std::string readName(const Card& card) {
+		if (auto name = sysfs::readString(card.device / "product_name"); name && !name->empty())
+			return *name;
+		auto vendor = sysfs::readString(card.device / "vendor").value_or("?");
+		auto device = sysfs::readString(card.device / "device").value_or("?");
+		return "AMD GPU [" + vendor + ":" + device + "]";
+	}
+
+	/** @brief The utilization of the GPU in percent (`gpu_busy_percent`). **/
+	inline std::optional<uint64_t> readBusyPercent(const Card& card) {
+		return sysfs::readUint(card.device / "gpu_busy_percent");
+	}
+	/** @brief The used VRAM in bytes (`mem_info_vram_used`). **/
+	inline std::optional<uint64_t> readVramUsed(const Card& card) {
+		return sysfs::readUint(card.device / "mem_info_vram_used");
+	}
+	/** @brief The total VRAM in bytes (`mem_info_vram_total`). **/
+	inline std::optional<uint64_t> readVramTotal(const Card& card) {
+		return sysfs::readUint(card.device / "mem_info_vram_total");
+	}
+	/**
+	 * @brief The power drawn by the card in microwatts, averaged by the firmware (`power1_average`) or, on newer
+	 * generations that only report the current value, `power1_input`.
+	 */
+	inline std::optional<uint64_t> readPower(const Card& card) {
+		if (card.hwmon.empty())
+			return std::nullopt;
+		if (auto power = sysfs::readUint(card.hwmon / "power1_average"))
+			return power;
+		return sysfs::readUint(card.hwmon / "power1_input");
+	}
+	/** @brief The energy consumed by the card in microjoules (`energy1_input`, only provided by some APUs). **/
+	inline std::optional<uint64_t> readEnergy(const Card& card) {
+		return card.hwmon.empty() ? std::nullopt : sysfs::readUint(card.hwmon / "energy1_input");
+	}
+	/**
+	 * @brief Reads a temperature of the card in degrees Celsius.
+	 * @param sensor The label of the sensor (edge, junction or mem).
+	 */
+	inline std::optional<int64_t> readTemperature(const Card& card, const std::string& sensor) {
+		if (card.hwmon.empty())
+			return std::nullopt;
+		for (unsigned i = 1; i <= 3; ++i) {
+			auto prefix = "temp" + std::to_string(i);
+			if (sysfs::readString(card.hwmon / (prefix + "_label")) == sensor) {
+				auto value = sysfs::readInt(card.hwmon / (prefix + "_input")); // In millidegrees
+				return value ? std::optional(*value / 1000) : std::nullopt;
+			}
+		}
+		return std::nullopt;
+	}
+	/**
+	 * @brief Reads a clock of the card in MHz.
+	 * @param clock The number of the hwmon frequency sensor (1 for the shader clock and 2 for the memory clock).
+	 */
+	inline std::optional<uint64_t> readClock(const Card& card, unsigned clock) {
+		if (card.hwmon.empty())
+			return std::nullopt;
+		auto value = sysfs::readUint(card.hwmon / ("freq" + std::to_string(clock) + "_input")); // In Hz
+		return value ? std::optional(*value / 1000000) : std::nullopt;
+	}
+
+	/**
+	 * @brief The usage of an amdgpu device by a DRM client (an open file description of the device) as reported by
+	 * `/proc/<pid>/fdinfo/<fd>`.
+	 * @details https://docs.kernel.org/gpu/drm-usage-stats.html
+	 */
+	struct ClientUsage {
+		uint64_t vramBytes = 0; /**< `drm-memory-vram` **/
+		uint64_t gfxNs = 0;		/**< The time the graphics engine was busy with the client (`drm-engine-gfx`) **/
+	};
+
+	/**
+	 * @brief Reads the DRM clients that the given processes opened on amdgpu devices.
+	 * @details Multiple file descriptors (also of different processes) may refer to the same client, which is why
+	 * they are deduplicated by their client ID.
+	 * @return the usage of each client by the PCI address of the device and the client ID.
+	 */
+	inline std::map<std::string, std::map<uint64_t, ClientUsage>> readClients(const std::vector<pid_t>& pids) {
+		std::map<std::string, std::map<uint64_t, ClientUsage>> clients;
+		for (auto pid : pids) {
+			std::error_code ec;
+			auto dir = procfs::pidPath(pid) / "fdinfo";
+			for (std::filesystem::directory_iterator it(dir, ec), end; !ec && it != end; it.increment(ec)) {
+				std::ifstream is(it->path());
+				std::string driver, pdev;
+				std::optional<uint64_t> clientId;
+				ClientUsage usage;
+				for (std::string line; std::getline(is, line);) {
+					auto colon = line.find(':');
+					if (colon == std::string::npos || !line.starts_with("drm-"))
+						continue;
+					auto key = line.substr(0, colon);
+					auto begin = line.find_first_not_of(" \t", colon + 1);
+					auto value = (begin == std::string::npos) ? std::string() : line.substr(begin);
+					uint64_t number = 0;
+					auto [ptr, _] = std::from_chars(value.data(), value.data() + value.size(), number);
+					if (key == "drm-driver")
+						driver = value;
+					else if (key == "drm-pdev")
+						pdev = value;
+					else if (key == "drm-client-id")
+						clientId = number;
+					else if (key == "drm-engine-gfx")
+						usage.gfxNs = number;
+					else if (key == "drm-memory-vram") {
+						// The unit depends on the size and kernel version
+						std::string_view unit(ptr, value.data() + value.size());
+						unit.remove_prefix(std::min(unit.find_first_not_of(' '), unit.size()));
+						usage.vramBytes = number * (unit == "KiB" ? 1024 : unit == "MiB" ? 1024 * 1024 : 1);
+					}
+				}
+				if (driver == "amdgpu" && clientId)
+					clients[pdev][*clientId] = usage;
+			}
+		}
+		return clients;
+	}
+} // namespace tirex::utils::amdgpu
+
+#endif
+
+#endif
@@ -0,0 +1,154 @@
+#ifndef MEASURE_UTILS_INFOCACHE_HPP
+#define MEASURE_UTILS_INFOCACHE_HPP
+
+#include "../stats/provider.hpp"
+
+#include <algorithm>
+#include <cctype>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <map>
+#include <mutex>
+#include <optional>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <utility>
+
+#if __linux__
+#include <sys/utsname.h>
+#include <unistd.h>
+#endif
+
+/**
+ * @brief Caches the static information of providers (e.g., the CPU model or the names of the GPUs), which does not
+ * change until the system is rebooted.
+ * @details Within a process, the information of a provider is only computed once. If `TIREX_INFO_CACHE` is set to a
+ * file, the information is additionally stored there such that later processes can reuse it. The file is keyed by the
+ * boot ID of the kernel, a fingerprint of the hardware and the version of the cache format and measures (see key())
+ * and discarded if any of them changed. Only string values are cached.
+ */
+namespace tirex::utils::infocache {
+	inline constexpr const char* header = "tirex-info-cache v2";
+
+	/**
+	 * @brief Identifies the current boot and hardware: the boot ID (`/proc/sys/kernel/random/boot_id`), the kernel,
+	 * the number of logical CPUs, the size of the physical memory, the sysfs root (see `TIREX_SYSFS_ROOT`) and the
+	 * number of measures, such that a cache written by an older version of the library (whose measures may differ in
+	 * their IDs or formats) is not reused.
+	 * @return the key or std::nullopt if the platform provides no boot ID, in which case nothing is stored on disk.
+	 */
+	inline std::optional<std::string> key() {
+#if __linux__
+		std::ifstream is("/proc/sys/kernel/random/boot_id");
+		std::string bootId;
+		if (!std::getline(is, bootId) || bootId.empty())
+			return std::nullopt;
+		struct utsname uts;
+		if (uname(&uts) != 0)
+			return std::nullopt;
+		auto memory = static_cast<uint64_t>(sysconf(_SC_PHYS_PAGES)) * static_cast<uint64_t>(sysconf(_SC_PAGESIZE));
+		auto sysfsRoot = std::getenv("TIREX_SYSFS_ROOT");
+		std::ostringstream os;
+		os << bootId << ' ' << uts.release << ' ' << uts.version << ' ' << uts.machine << ' '
+		   << std::thread::hardware_concurrency() << ' ' << memory << ' ' << ((sysfsRoot != nullptr) ? sysfsRoot : "")
+		   << ' ' << static_cast<int>(TIREX_MEASURE_COUNT);
+		auto key = os.str();
+		std::replace(key.begin(), key.end(), '\n', ' ');
+		return key;
+#else
+		/** \todo: use the boot session UUID on macOS and the boot time on Windows */
+		return std::nullopt;
+#endif
+	}
+
+	/** The cached string values by the name of the provider (and its variant, see get()) **/
+	using Entries = std::map<std::string, std::map<tirexMeasure, std::string>>;
+
+	/**
+	 * @brief Reads the cache file. Each entry consists of a line `<provider> <measure> <length>` followed by the
+	 * value of the given length and a line break.
+	 * @return the entries or nothing if the file does not exist, is malformed or was written for another key.
+	 */
+	inline Entries load(const std::filesystem::path& file, const std::string& cacheKey) {
+		std::ifstream is(file, std::ios::binary);
+		std::string line;
+		if (!std::getline(is, line) || line != header || !std::getline(is, line) || line != cacheKey)
+			return {};
+		Entries entries;
+		std::string provider;
+		int measure;
+		size_t length;
+		while (is >> provider >> measure >> length && is.get() == '\n') {
+			std::string value(length, '\0');
+			if (!is.read(value.data(), static_cast<std::streamsize>(length)) || is.get() != '\n')
+				return {};
+			entries[provider][static_cast<tirexMeasure>(measure)] = std::move(value);
+		}
+		return entries;
+	}
+
+	/** @brief Writes the entries to a temporary file that then replaces the cache file atomically. **/
+	inline void store(const std::filesystem::path& file, const std::string& cacheKey, const Entries& entries) {
+		auto tmp = file;
+		tmp += "." + std::to_string(std::chrono::steady_clock::now().time_since_epoch().count()) + ".tmp";
+		std::ofstream os(tmp, std::ios::binary | std::ios::trunc);
+		os << header << '\n' << cacheKey << '\n';
+		for (const auto& [provider, values] : entries) {
+			for (const auto& [measure, value] : values)
+				os << provider << ' ' << static_cast<int>(measure) << ' ' << value.size() << '\n' << value << '\n';
+		}
+		os.close();
+		std::error_code ec;
+		if (os)
+			std::filesystem::rename(tmp, file, ec);
+		if (!os || ec)
+			std::filesystem::remove(tmp, ec);
+	}
+
+	/**
+	 * @brief Returns the information of the provider from the cache or computes it using the given function and adds
+	 * it to the cache.
+	 * @param provider The name of the provider (as registered in tirex::providers).
+	 * @param variant Distinguishes information that differs between processes with the same key() (e.g., the GPUs
+	 * that are visible to a container). Each variant is cached separately.
+	 */
+	inline Stats get(const std::string& provider, const std::function<Stats()>& compute, std::string variant = {}) {
+		static std::mutex mutex;
+		static std::map<std::string, Stats> memory;
+		// The names are whitespace separated in the cache file
+		std::ranges::replace_if(variant, [](unsigned char c) { return std::isspace(c); }, '_');
+		auto name = variant.empty() ? provider : provider + '@' + variant;
+		std::lock_guard lock(mutex);
+		if (auto it = memory.find(name); it != memory.end())
+			return it->second;
+
+		auto env = std::getenv("TIREX_INFO_CACHE");
+		auto cacheKey = (env != nullptr && *env != '\0') ? key() : std::nullopt;
+		Entries entries = cacheKey ? load(env, *cacheKey) : Entries{};
+		if (auto it = entries.find(name); it != entries.end()) {
+			Stats stats;
+			for (const auto& [measure, value] : it->second)
+				stats.emplace(measure, value);
+			return memory[name] = std::move(stats);
+		}
+
+		auto stats = compute();
+		std::map<tirexMeasure, std::string> values;
+		for (const auto& [measure, value] : stats) {
+			if (auto str = std::get_if<std::string>(&value))
+				values.emplace(measure, *str);
+		}
+		if (cacheKey && values.size() == stats.size()) {
+			entries[name] = std::move(values);
+			store(env, *cacheKey, entries);
+		}
+		return memory[name] = std::move(stats);
+	}
+} // namespace tirex::utils::infocache
+
+#endif
@@ -0,0 +1,363 @@
+#ifndef MEASURE_UTILS_PROCFS_HPP
+#define MEASURE_UTILS_PROCFS_HPP
+
+#if defined(__linux__)
+
+#include <sys/types.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cctype>
+#include <charconv>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <map>
+#include <optional>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace tirex::utils::procfs {
+	/**
+	 * @brief The subset of the fields of `/proc/<pid>/stat` (or `/proc/<pid>/task/<tid>/stat`) that we are interested
+	 * in.
+	 * @details Table 1-4 in https://www.kernel.org/doc/html/latest/filesystems/proc.html
+	 */
+	struct TaskStat {
+		pid_t pid;
+		std::string comm;
+		char state;
+		pid_t ppid;
+		uint64_t minflt;
+		uint64_t majflt;
+		uint64_t utime;	 /**< Time spent in user mode (in clock ticks) **/
+		uint64_t stime;	 /**< Time spent in kernel mode (in clock ticks) **/
+		uint64_t cutime; /**< Time waited-for children spent in user mode (in clock ticks) **/
+		uint64_t cstime; /**< Time waited-for children spent in kernel mode (in clock ticks) **/
+		uint64_t numThreads;
+		uint64_t starttime; /**< Time the process started after system boot (in clock ticks) **/
+		uint64_t rss;		/**< Resident set size (in pages) **/
+		int processor;		/**< The CPU the task last ran on **/
+		/** Time spent waiting for block I/O (in clock ticks), only counted if delay accounting is enabled **/
+		uint64_t blkioTicks;
+	};
+
+	inline std::filesystem::path pidPath(pid_t pid) { return std::filesystem::path("/proc") / std::to_string(pid); }
+
+	inline uint64_t ticksToMs(uint64_t ticks) {
+		static const auto ticksPerSec = static_cast<uint64_t>(sysconf(_SC_CLK_TCK));
+		return (ticks * 1000u) / ticksPerSec;
+	}
+
+	/**
+	 * @brief Parses a `stat` file of a process or a task.
+	 *
+	 * @param file The path to the stat file (e.g., `/proc/self/stat`).
+	 * @return the parsed contents or std::nullopt if the file could not be read (e.g., since the task already exited).
+	 */
+	inline std::optional<TaskStat> readStat(const std::filesystem::path& file) {
+		std::ifstream is(file);
+		std::string line;
+		if (!std::getline(is, line))
+			return std::nullopt;
+		// The command name may contain spaces and parentheses, so we search for the last closing parenthesis
+		auto open = line.find('(');
+		auto close = line.rfind(')');
+		if (open == std::string::npos || close == std::string::npos || close < open)
+			return std::nullopt;
+		TaskStat stat{};
+		stat.pid = static_cast<pid_t>(std::stol(line.substr(0, open)));
+		stat.comm = line.substr(open + 1, close - open - 1);
+		std::istringstream fields(line.substr(close + 1));
+		std::string ignore; // Some of the skipped fields may be negative (e.g., tpgid)
+		fields >> stat.state >> stat.ppid;
+		for (auto i = 0; i < 4; ++i) // pgrp, session, tty_nr, tpgid
+			fields >> ignore;
+		fields >> ignore >> stat.minflt >> ignore >> stat.majflt >> ignore; // flags, minflt, cminflt, majflt, cmajflt
+		fields >> stat.utime >> stat.stime >> stat.cutime >> stat.cstime;
+		fields >> ignore >> ignore >> stat.numThreads >> ignore >> stat.starttime; // priority, nice, ..., itrealvalue
+		fields >> ignore >> stat.rss;											   // vsize, rss
+		for (auto i = 0; i < 14; ++i) // rsslim, startcode, ..., exit_signal
+			fields >> ignore;
+		fields >> stat.processor;
+		if (!fields)
+			return std::nullopt;
+		fields >> ignore >> ignore >> stat.blkioTicks; // rt_priority, policy, delayacct_blkio_ticks
+		if (!fields)
+			stat.blkioTicks = 0;
+		return stat;
+	}
+	inline std::optional<TaskStat> readStat(pid_t pid) { return readStat(pidPath(pid) / "stat"); }
+	inline std::optional<TaskStat> readStat(pid_t pid, pid_t tid) {
+		return readStat(pidPath(pid) / "task" / std::to_string(tid) / "stat");
+	}
+
+	/**
+	 * @brief Parses files that consist of `Key: value` lines, like `/proc/meminfo`, `/proc/<pid>/status` or
+	 * `/proc/<pid>/smaps_rollup`.
+	 * @details Only lines whose value starts with a number are returned. Units (e.g., "kB") are dropped.
+	 *
+	 * @return a mapping from each key (without the colon) to its value, which is empty if the file could not be read.
+	 */
+	inline std::map<std::string, uint64_t> readFields(const std::filesystem::path& file) {
+		std::map<std::string, uint64_t> fields;
+		std::ifstream is(file);
+		for (std::string line; std::getline(is, line);) {
+			auto colon = line.find(':');
+			if (colon == std::string::npos)
+				continue;
+			auto begin = line.find_first_not_of(" \t", colon + 1);
+			if (begin == std::string::npos)
+				continue;
+			uint64_t value;
+			auto [_, ec] = std::from_chars(line.data() + begin, line.data() + line.size(), value);
+			if (ec == std::errc())
+				fields.emplace(line.substr(0, colon), value);
+		}
+		return fields;
+	}
+
+	/**
+	 * @brief The time all logical CPUs of the system spent busy and idle as reported by the `cpu` line of `/proc/stat`.
+	 * @details Section 1.7 in https://www.kernel.org/doc/html/latest/filesystems/proc.html
+	 */
+	struct CpuTimes {
+		/** Time spent in user mode, with low priority, in kernel mode and serving interrupts (in clock ticks) **/
+		uint64_t busy;
+		uint64_t idle; /**< Time spent idle or waiting for I/O to complete (in clock ticks) **/
+	};
+
+	inline std::optional<CpuTimes> readCpuTimes() {
+		std::ifstream is("/proc/stat");
+		std::string cpu;
+		uint64_t user, nice, system, idle, iowait, irq, softirq;
+		if (!(is >> cpu >> user >> nice >> system >> idle >> iowait >> irq >> softirq) || cpu != "cpu")
+			return std::nullopt;
+		return CpuTimes{.busy = user + nice + system + irq + softirq, .idle = idle + iowait};
+	}
+
+	/**
+	 * @brief Returns the times of each logical CPU (the `cpu<N>` lines of `/proc/stat`) indexed by the CPU's number.
+	 * CPUs that are offline are reported as zero.
+	 */
+	inline std::vector<CpuTimes> readCoreCpuTimes() {
+		std::ifstream is("/proc/stat");
+		std::vector<CpuTimes> cores;
+		for (std::string line; std::getline(is, line) && line.starts_with("cpu");) {
+			std::istringstream fields(line);
+			std::string cpu;
+			uint64_t user, nice, system, idle, iowait, irq, softirq;
+			if (!(fields >> cpu >> user >> nice >> system >> idle >> iowait >> irq >> softirq) || cpu == "cpu")
+				continue;
+			auto core = std::stoul(cpu.substr(3));
+			if (core >= cores.size())
+				cores.resize(core + 1, CpuTimes{});
+			cores[core] = CpuTimes{.busy = user + nice + system + irq + softirq, .idle = idle + iowait};
+		}
+		return cores;
+	}
+
+	/**
+	 * @brief The I/O statistics of a process or task as reported by `/proc/<pid>/io`.
+	 * @details Section 3.3 in https://www.kernel.org/doc/html/latest/filesystems/proc.html. The statistics of a process
+	 * include those of its exited threads and of all children that it waited for.
+	 */
+	struct IoStat {
+		uint64_t rchar;		 /**< Bytes read using read-like system calls (including, e.g., from the page cache) **/
+		uint64_t wchar;		 /**< Bytes written using write-like system calls **/
+		uint64_t syscr;		 /**< Number of read-like system calls **/
+		uint64_t syscw;		 /**< Number of write-like system calls **/
+		uint64_t readBytes;	 /**< Bytes that were actually fetched from the storage layer **/
+		uint64_t writeBytes; /**< Bytes that were actually sent to the storage layer **/
+
+		IoStat& operator+=(const IoStat& other) noexcept {
+			rchar += other.rchar;
+			wchar += other.wchar;
+			syscr += other.syscr;
+			syscw += other.syscw;
+			readBytes += other.readBytes;
+			writeBytes += other.writeBytes;
+			return *this;
+		}
+	};
+
+	/**
+	 * @brief Parses an `io` file of a process or a task.
+	 *
+	 * @param file The path to the io file (e.g., `/proc/self/io`).
+	 * @return the parsed contents or std::nullopt if the file could not be read (e.g., since the process already exited
+	 * or we lack the permissions to read it).
+	 */
+	inline std::optional<IoStat> readIo(const std::filesystem::path& file) {
+		std::ifstream is(file);
+		if (!is)
+			return std::nullopt;
+		IoStat stat{};
+		std::string key;
+		size_t found = 0;
+		for (uint64_t value; is >> key >> value;) {
+			if (key == "rchar:")
+				stat.rchar = value;
+			else if (key == "wchar:")
+				stat.wchar = value;
+			else if (key == "syscr:")
+				stat.syscr = value;
+			else if (key == "syscw:")
+				stat.syscw = value;
+			else if (key == "read_bytes:")
+				stat.readBytes = value;
+			else if (key == "write_bytes:")
+				stat.writeBytes = value;
+			else
+				continue;
+			++found;
+		}
+		if (found == 0)
+			return std::nullopt;
+		return stat;
+	}
+	inline std::optional<IoStat> readIo(pid_t pid) { return readIo(pidPath(pid) / "io"); }
+	inline std::optional<IoStat> readIo(pid_t pid, pid_t tid) {
+		return readIo(pidPath(pid) / "task" / std::to_string(tid) / "io");
+	}
+
+	/**
+	 * @brief The scheduler statistics of a task as reported by `/proc/<pid>/task/<tid>/schedstat`.
+	 * @details https://docs.kernel.org/scheduler/sched-stats.html; the file only exists if the kernel was built with
+	 * CONFIG_SCHED_INFO.
+	 */
+	struct SchedStat {
+		uint64_t runNs;		 /**< Time spent on the CPU **/
+		uint64_t waitNs;	 /**< Time spent runnable but waiting on a run queue **/
+		uint64_t timeslices; /**< Number of timeslices run on this CPU **/
+	};
+
+	/**
+	 * @brief Parses a `schedstat` file of a process or a task.
+	 * @return the parsed contents or std::nullopt if the file could not be read.
+	 */
+	inline std::optional<SchedStat> readSchedStat(const std::filesystem::path& file) {
+		std::ifstream is(file);
+		SchedStat stat{};
+		if (!(is >> stat.runNs >> stat.waitNs >> stat.timeslices))
+			return std::nullopt;
+		return stat;
+	}
+	inline std::optional<SchedStat> readSchedStat(pid_t pid, pid_t tid) {
+		return readSchedStat(pidPath(pid) / "task" / std::to_string(tid) / "schedstat");
+	}
+
+	/**
+	 * @brief Returns the command line of the given process with the arguments separated by spaces.
+	 * @details The command line is empty for kernel threads and processes that already exited (zombies).
+	 */
+	inline std::string readCmdline(pid_t pid) {
+		std::ifstream is(pidPath(pid) / "cmdline", std::ios::binary);
+		std::string cmdline{std::istreambuf_iterator<char>(is), std::istreambuf_iterator<char>()};
+		while (!cmdline.empty() && cmdline.back() == '\0')
+			cmdline.pop_back();
+		std::replace(cmdline.begin(), cmdline.end(), '\0', ' ');
+		return cmdline;
+	}
+
+	/**
+	 * @brief Returns the directory of the (unified, v2) cgroup that the given process belongs to.
+	 * @details Supports the unified hierarchy mounted at `/sys/fs/cgroup` or, for hybrid setups, at
+	 * `/sys/fs/cgroup/unified`.
+	 * @return the directory or std::nullopt if the process is not part of a v2 cgroup.
+	 */
+	inline std::optional<std::filesystem::path> cgroupPath(pid_t pid) {
+		std::ifstream is(pidPath(pid) / "cgroup");
+		for (std::string line; std::getline(is, line);) {
+			if (!line.starts_with("0::"))
+				continue;
+			auto relative = std::filesystem::path(line.substr(3)).relative_path();
+			for (const char* mount : {"/sys/fs/cgroup", "/sys/fs/cgroup/unified"}) {
+				std::error_code ec;
+				if (std::filesystem::exists(std::filesystem::path(mount) / "cgroup.controllers", ec))
+					return std::filesystem::path(mount) / relative;
+			}
+		}
+		return std::nullopt;
+	}
+
+	/**
+	 * @brief Returns the IDs of all threads (tasks) of the given process.
+	 */
+	inline std::vector<pid_t> listTasks(pid_t pid) {
+		std::vector<pid_t> tasks;
+		std::error_code ec; // The process may exit at any time, so we must not throw here
+		for (std::filesystem::directory_iterator it(pidPath(pid) / "task", ec), end; !ec && it != end; it.increment(ec))
+			tasks.emplace_back(static_cast<pid_t>(std::stol(it->path().filename().string())));
+		return tasks;
+	}
+
+	/**
+	 * @brief Returns the IDs of all direct children of the given process.
+	 * @details Uses `/proc/<pid>/task/<tid>/children` if it is available (CONFIG_PROC_CHILDREN) and falls back to
+	 * scanning all processes otherwise.
+	 */
+	inline std::vector<pid_t> listChildren(pid_t pid) {
+		std::vector<pid_t> children;
+		if (std::filesystem::exists(pidPath(pid) / "task" / std::to_string(pid) / "children")) {
+			for (auto tid : listTasks(pid)) {
+				std::ifstream is(pidPath(pid) / "task" / std::to_string(tid) / "children");
+				for (pid_t child; is >> child;)
+					children.emplace_back(child);
+			}
+		} else {
+			std::error_code ec;
+			for (std::filesystem::directory_iterator it("/proc", ec), end; !ec && it != end; it.increment(ec)) {
+				auto name = it->path().filename().string();
+				if (name.empty() || !std::isdigit(static_cast<unsigned char>(name.front())))
+					continue;
+				if (auto stat = readStat(it->path() / "stat"); stat && stat->ppid == pid)
+					children.emplace_back(stat->pid);
+			}
+		}
+		return children;
+	}
+
+	/**
+	 * @brief Returns the given process followed by all of its (transitive) children that are currently alive.
+	 */
+	inline std::vector<pid_t> listProcessTree(pid_t root) {
+		std::vector<pid_t> tree{root};
+		for (size_t i = 0; i < tree.size(); ++i) {
+			auto children = listChildren(tree[i]);
+			tree.insert(tree.end(), children.begin(), children.end());
+		}
+		return tree;
+	}
+
+	/**
+	 * @brief Returns the IDs of the given processes and all of their (transitive) children. Processes that are part of
+	 * more than one of the trees are only listed once.
+	 */
+	inline std::vector<pid_t> listProcessTree(const std::vector<pid_t>& roots) {
+		std::vector<pid_t> tree;
+		for (auto root : roots) {
+			for (auto process : listProcessTree(root)) {
+				if (std::find(tree.begin(), tree.end(), process) == tree.end())
+					tree.emplace_back(process);
+			}
+		}
+		return tree;
+	}
+
+	/**
+	 * @brief Converts the process IDs passed by the user into pid_t and falls back to the calling process if none were
+	 * given.
+	 */
+	inline std::vector<pid_t> toPids(const std::vector<uint32_t>& ids) {
+		if (ids.empty())
+			return {getpid()};
+		return std::vector<pid_t>(ids.begin(), ids.end());
+	}
+} // namespace tirex::utils::procfs
+
+#endif
+
+#endif
\ No newline at end of file
@@ -0,0 +1,127 @@
+#ifndef MEASURE_UTILS_SYSFS_HPP
+#define MEASURE_UTILS_SYSFS_HPP
+
+#if defined(__linux__)
+
+#include <algorithm>
+#include <cctype>
+#include <charconv>
+#include <cstdint>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace tirex::utils::sysfs {
+	/**
+	 * @brief Returns the directory that sysfs is mounted at.
+	 * @details This is `/sys` unless it is overridden by the `TIREX_SYSFS_ROOT` environment variable, which allows to
+	 * test the providers that read from sysfs against a fixture directory.
+	 */
+	inline const std::filesystem::path& root() {
+		static const std::filesystem::path path = []() {
+			auto env = std::getenv("TIREX_SYSFS_ROOT");
+			return std::filesystem::path((env != nullptr && *env != '\0') ? env : "/sys");
+		}();
+		return path;
+	}
+
+	/**
+	 * @brief Reads the first line of the file without the trailing newline.
+	 * @return the line or std::nullopt if the file could not be read.
+	 */
+	inline std::optional<std::string> readString(const std::filesystem::path& file) {
+		std::ifstream is(file);
+		std::string line;
+		if (!std::getline(is, line))
+			return std::nullopt;
+		return line;
+	}
+
+	/**
+	 * @brief Reads a file that contains a single unsigned integer.
+	 * @return the value or std::nullopt if the file could not be read or does not start with a number.
+	 */
+	inline std::optional<uint64_t> readUint(const std::filesystem::path& file) {
+		auto line = readString(file);
+		if (!line)
+			return std::nullopt;
+		uint64_t value;
+		auto [ptr, ec] = std::from_chars(line->data(), line->data() + line->size(), value);
+		if (ec != std::errc{})
+			return std::nullopt;
+		return value;
+	}
+
+	/**
+	 * @brief Reads a file that contains a single signed integer (e.g., a temperature).
+	 * @return the value or std::nullopt if the file could not be read or does not start with a number.
+	 */
+	inline std::optional<int64_t> readInt(const std::filesystem::path& file) {
+		auto line = readString(file);
+		if (!line)
+			return std::nullopt;
+		int64_t value;
+		auto [ptr, ec] = std::from_chars(line->data(), line->data() + line->size(), value);
+		if (ec != std::errc{})
+			return std::nullopt;
+		return value;
+	}
+
+	/**
+	 * @brief Lists the entries of the directory whose name consists of the prefix followed by a number (e.g., `cpu12`
+	 * for the prefix `cpu`), ordered by that number.
+	 */
+	inline std::vector<std::filesystem::path> listNumbered(const std::filesystem::path& dir, std::string_view prefix) {
+		std::vector<std::pair<unsigned long, std::filesystem::path>> entries;
+		std::error_code ec;
+		for (std::filesystem::directory_iterator it(dir, ec), end; !ec && it != end; it.increment(ec)) {
+			auto name = it->path().filename().string();
+			if (!name.starts_with(prefix) || name.size() == prefix.size())
+				continue;
+			auto suffix = std::string_view(name).substr(prefix.size());
+			if (!std::ranges::all_of(suffix, [](unsigned char c) { return std::isdigit(c); }))
+				continue;
+			entries.emplace_back(std::stoul(std::string(suffix)), it->path());
+		}
+		std::ranges::sort(entries, {}, [](const auto& entry) { return entry.first; });
+		std::vector<std::filesystem::path> paths;
+		for (auto& [_, path] : entries)
+			paths.emplace_back(std::move(path));
+		return paths;
+	}
+
+	/**
+	 * @brief Reads a list of CPUs in the format that sysfs uses for CPU masks (e.g., `0-3,8,10-11`).
+	 * @return the IDs of the CPUs in ascending order or nothing if the file does not exist.
+	 */
+	inline std::vector<uint32_t> readCpuList(const std::filesystem::path& file) {
+		std::vector<uint32_t> cpus;
+		auto list = readString(file);
+		if (!list)
+			return cpus;
+		std::string_view rest = *list;
+		while (!rest.empty()) {
+			auto range = rest.substr(0, rest.find(','));
+			rest.remove_prefix(std::min(range.size() + 1, rest.size()));
+			uint32_t first = 0, last = 0;
+			auto [ptr, ec] = std::from_chars(range.data(), range.data() + range.size(), first);
+			if (ec != std::errc())
+				continue;
+			last = first;
+			if (ptr != range.data() + range.size() && *ptr == '-')
+				std::from_chars(ptr + 1, range.data() + range.size(), last);
+			for (auto cpu = first; cpu <= last; ++cpu)
+				cpus.emplace_back(cpu);
+		}
+		std::ranges::sort(cpus);
+		return cpus;
+	}
+} // namespace tirex::utils::sysfs
+
+#endif
+
+#endif
@@ -8,22 +8,42 @@
 #include <future>
 #include <iostream>
 #include <ranges>
+#include <set>
 #include <sstream>
 #include <thread>
 #include <vector>
 
+#if __linux__
+#include "measure/utils/procfs.hpp"
+#elif _WINDOWS
+#include <windows.h>
+#undef ERROR //  Make problems with logging.h otherwise
+#elif __APPLE__
+#include <libproc.h>
+#endif
+
+/**
+ * @brief Removes the results of measures that were not requested, which providers may compute along with the requested
+ * ones.
+ */
+static void filterStats(tirex::Stats& stats, const std::set<tirexMeasure>& requested) {
+	std::erase_if(stats, [&requested](const auto& entry) { return !requested.contains(entry.first); });
+}
+
 struct tirexMeasureHandle_st final {
 	size_t pollIntervalMs;
 	const std::vector<std::unique_ptr<tirex::StatsProvider>> providers;
+	const std::set<tirexMeasure> measures; /**< The requested measures **/
 	std::thread monitorthread;
 	std::promise<void> signal;
 
 	tirexMeasureHandle_st(tirexMeasureHandle_st& other) = delete;
 
 	explicit tirexMeasureHandle_st(
-			std::vector<std::unique_ptr<tirex::StatsProvider>>&& _providers, size_t pollIntervalMs
+			std::vector<std::unique_ptr<tirex::StatsProvider>>&& _providers, std::set<tirexMeasure>&& measures,
+			size_t pollIntervalMs
 	) noexcept
-			: pollIntervalMs(pollIntervalMs), providers(std::move(_providers)) {
+			: pollIntervalMs(pollIntervalMs), providers(std::move(_providers)), measures(std::move(measures)) {
 		// Start measuring
 		tirex::log::info("measure", "Start Measuring");
 		for (auto& provider : providers)
@@ -46,6 +66,7 @@ struct tirexMeasureHandle_st final {
 			auto tmp = provider->getStats();
 			stats.insert(tmp.begin(), tmp.end());
 		}
+		filterStats(stats, measures);
 		return stats;
 	}
 
@@ -59,9 +80,10 @@ struct tirexMeasureHandle_st final {
 	}
 };
 
-static tirexError
-initProviders(const tirexMeasureConf* measures, std::vector<std::unique_ptr<tirex::StatsProvider>>& providers) {
-	std::set<tirexMeasure> tirexset;
+static tirexError initProviders(
+		const tirexMeasureConf* measures, std::vector<std::unique_ptr<tirex::StatsProvider>>& providers,
+		std::set<tirexMeasure>& tirexset, const tirex::TrackingConf& conf = {}
+) {
 	for (auto conf = measures; conf->source != tirexMeasure::TIREX_MEASURE_INVALID; ++conf) {
 		auto [it, inserted] = tirexset.insert(conf->source); /** \todo implement **/
 		if (!inserted) {
@@ -71,7 +93,7 @@ initProviders(const tirexMeasureConf* measures, std::vector<std::unique_ptr<tire
 			);
 		}
 	}
-	auto unmatched = tirex::initProviders(tirexset, providers);
+	auto unmatched = tirex::initProviders(tirexset, providers, conf);
 	if (!unmatched.empty()) {
 		/** \todo if pedantic abort here **/
 		/** \todo log which are not associated **/
@@ -82,22 +104,61 @@ initProviders(const tirexMeasureConf* measures, std::vector<std::unique_ptr<tire
 
 tirexError tirexFetchInfo(const tirexMeasureConf* measures, tirexResult** result) {
 	std::vector<std::unique_ptr<tirex::StatsProvider>> providers;
-	if (tirexError err; (err = initProviders(measures, providers)) != TIREX_SUCCESS)
+	std::set<tirexMeasure> requested;
+	if (tirexError err; (err = initProviders(measures, providers, requested)) != TIREX_SUCCESS)
 		return err;
 	tirex::Stats stats{}; /** \todo ranges **/
 	for (auto& provider : providers) {
 		auto tmp = provider->getInfo();
 		stats.insert(tmp.begin(), tmp.end());
 	}
+	filterStats(stats, requested);
 	*result = createMsrResultFromStats(std::move(stats));
 	return TIREX_SUCCESS;
 }
 
+/**
+ * @brief Returns true if the process with the given ID exists and its resource usage can be read.
+ */
+static bool canTrackProcess(uint32_t pid) {
+#if __linux__
+	return tirex::utils::procfs::readStat(static_cast<pid_t>(pid)).has_value();
+#elif _WINDOWS
+	auto handle = OpenProcess(PROCESS_QUERY_LIMITED_INFORMATION | PROCESS_VM_READ, FALSE, pid);
+	if (handle == nullptr)
+		return false;
+	CloseHandle(handle);
+	return true;
+#elif __APPLE__
+	proc_taskinfo taskInfo;
+	return proc_pidinfo(static_cast<pid_t>(pid), PROC_PIDTASKINFO, 0, &taskInfo, PROC_PIDTASKINFO_SIZE) > 0;
+#else
+	return true;
+#endif
+}
+
 tirexError tirexStartTracking(const tirexMeasureConf* measures, size_t pollIntervalMs, tirexMeasureHandle** handle) {
+	return tirexStartTrackingPids(measures, nullptr, 0, pollIntervalMs, handle);
+}
+
+tirexError tirexStartTrackingPids(
+		const tirexMeasureConf* measures, const uint32_t* pids, size_t numPids, size_t pollIntervalMs,
+		tirexMeasureHandle** handle
+) {
+	if (pids == nullptr && numPids != 0)
+		return TIREX_INVALID_ARGUMENT;
+	for (size_t i = 0; i < numPids; ++i) {
+		if (!canTrackProcess(pids[i])) {
+			tirex::log::error("measure", "The process {} does not exist or cannot be tracked", pids[i]);
+			return TIREX_INVALID_ARGUMENT;
+		}
+	}
+	tirex::TrackingConf conf{.pids = {pids, pids + numPids}, .measures = {}};
 	std::vector<std::unique_ptr<tirex::StatsProvider>> providers;
-	if (tirexError err; (err = initProviders(measures, providers)) != TIREX_SUCCESS)
+	std::set<tirexMeasure> requested;
+	if (tirexError err; (err = initProviders(measures, providers, requested, conf)) != TIREX_SUCCESS)
 		return err;
-	*handle = new tirexMeasureHandle{std::move(providers), pollIntervalMs};
+	*handle = new tirexMeasureHandle{std::move(providers), std::move(requested), pollIntervalMs};
 	return TIREX_SUCCESS;
 }
 
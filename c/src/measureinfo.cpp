@@ -30,16 +30,18 @@ static const tirexMeasureInfo measureInfos[]{
 		 .datatype = tirexResultType::TIREX_STRING,
 		 .example = "1234"},
 		/*[TIREX_TIME_ELAPSED_USER_MS] = */
-		{.description = "Time spent in the platform's user mode.",
+		{.description = "Time in milliseconds that the tracked processes and their children spent in the platform's "
+						"user mode.",
 		 .datatype = tirexResultType::TIREX_STRING,
 		 .example = "1234"},
 		/*[TIREX_TIME_ELAPSED_SYSTEM_MS] = */
-		{.description = "Time spent in the platform's system mode.",
+		{.description = "Time in milliseconds that the tracked processes and their children spent in the platform's "
+						"system mode.",
 		 .datatype = tirexResultType::TIREX_STRING,
 		 .example = "1234"},
 		// CPU
 		/*[TIREX_CPU_USED_PROCESS_PERCENT] = */
-		{.description = "CPU usage of the tracked process in percent per logical CPU cores.",
+		{.description = "CPU usage of the tracked processes and their children in percent of a single logical core.",
 		 .datatype = tirexResultType::TIREX_STRING,
 		 .example = "TODO"},
 		/*[TIREX_CPU_USED_SYSTEM_PERCENT] = */
@@ -53,7 +55,7 @@ static const tirexMeasureInfo measureInfos[]{
 		/*[TIREX_CPU_ENERGY_SYSTEM_JOULES] = */
 		{.description = "The energy consumed by the CPU by the entire system over the tracked period in joules. ",
 		 .datatype = tirexResultType::TIREX_STRING,
-		 .example = "TODO"},
+		 .example = "1520.125"},
 		/*[TIREX_CPU_FEATURES] = */
 		{.description = "List of hardware features the CPU supports (e.g., the instruction set, encryption "
 						"capabilities).",
@@ -104,7 +106,7 @@ static const tirexMeasureInfo measureInfos[]{
 		 .example = "VT-x"},
 		// RAM
 		/*[TIREX_RAM_USED_PROCESS_KB] = */
-		{.description = "RAM usage of the tracked process in kilobytes.",
+		{.description = "RAM usage (resident set size) of the tracked processes and their children in kilobytes.",
 		 .datatype = tirexResultType::TIREX_STRING,
 		 .example = "TODO"},
 		/*[TIREX_RAM_USED_SYSTEM_MB] = */
@@ -118,7 +120,7 @@ static const tirexMeasureInfo measureInfos[]{
 		/*[TIREX_RAM_ENERGY_SYSTEM_JOULES] = */
 		{.description = "The energy consumed by the DRAM by the entire system over the tracked period in joules.",
 		 .datatype = tirexResultType::TIREX_STRING,
-		 .example = "TODO"},
+		 .example = "98.750"},
 		// GPU
 		/*[TIREX_GPU_SUPPORTED] = */
 		{.description = "1 if a GPU is detected in the system, and we support tracking it; 0 otherwise.",
@@ -133,38 +135,40 @@ static const tirexMeasureInfo measureInfos[]{
 		 .datatype = tirexResultType::TIREX_STRING,
 		 .example = "TODO"},
 		/*[TIREX_GPU_USED_PROCESS_PERCENT] = */
-		{.description = "GPU usage of the tracked process in percent.",
+		{.description = "SM utilization of the GPUs caused by the tracked process and its children in percent "
+						"(averaged over all GPUs).",
 		 .datatype = tirexResultType::TIREX_STRING,
-		 .example = "TODO"},
+		 .example = "{max: 99, min: 12, avg: 64, timeseries: {timestamps: [100ms,200ms], values: [99,12]}}"},
 		/*[TIREX_GPU_USED_SYSTEM_PERCENT] = */
-		{.description = "GPU utilization of the entire system in percent.",
+		{.description = "GPU utilization of the entire system in percent (averaged over all GPUs).",
 		 .datatype = tirexResultType::TIREX_STRING,
-		 .example = "TODO"},
+		 .example = "{max: 99, min: 12, avg: 64, timeseries: {timestamps: [100ms,200ms], values: [99,12]}}"},
 		/*[TIREX_GPU_VRAM_USED_PROCESS_MB] = */
-		{.description = "GPU VRAM usage of the tracked process in megabyte.",
+		{.description = "GPU VRAM usage of the tracked process and its children in megabyte (summed over all "
+						"GPUs).",
 		 .datatype = tirexResultType::TIREX_STRING,
-		 .example = "TODO"},
+		 .example = "{max: 2048, min: 0, avg: 1024, timeseries: {timestamps: [100ms,200ms], values: [0,2048]}}"},
 		/*[TIREX_GPU_VRAM_USED_SYSTEM_MB] = */
-		{.description = "GPU VRAM usage of the entire system in megabytes.",
+		{.description = "GPU VRAM usage of the entire system in megabytes (summed over all GPUs).",
 		 .datatype = tirexResultType::TIREX_STRING,
-		 .example = "TODO"},
+		 .example = "{max: 2048, min: 0, avg: 1024, timeseries: {timestamps: [100ms,200ms], values: [0,2048]}}"},
 		/*[TIREX_GPU_VRAM_AVAILABLE_SYSTEM_MB] = */
 		{.description = "Amount of GPU VRAM available in the system in megabytes.",
 		 .datatype = tirexResultType::TIREX_STRING,
 		 .example = "TODO"},
 		/*[TIREX_GPU_ENERGY_SYSTEM_JOULES] = */
-		{.description = "The energy consumed by the GPU for the entire system in joules.",
+		{.description = "The energy consumed by all GPUs since tracking started in joules (if supported).",
 		 .datatype = tirexResultType::TIREX_STRING,
-		 .example = "TODO"},
+		 .example = "4210.532"},
 		// Git
 		/*[TIREX_GIT_IS_REPO] = */
 		{.description = "1 if the current working directory is (part of) a Git repository; 0 otherwise",
 		 .datatype = tirexResultType::TIREX_STRING,
 		 .example = "1"},
 		/*[TIREX_GIT_HASH] =*/
-		{.description = "SHA1 hash of all files checked into the repository.",
+		{.description = "XXH3 (128 bit) hash of the paths and contents of all tracked and untracked files.",
 		 .datatype = tirexResultType::TIREX_STRING,
-		 .example = "aa5fba7feff8605c3b253b46fc86d7ac1732a586"},
+		 .example = "bc49b9b4b2d66c1c729ea1e401cc067c"},
 		/*[TIREX_GIT_LAST_COMMIT_HASH] =*/
 		{.description = "Latest Git commit SHA1 hash.",
 		 .datatype = tirexResultType::TIREX_STRING,
@@ -196,6 +200,532 @@ static const tirexMeasureInfo measureInfos[]{
 						"into the repository; 0 otherwise.",
 		 .datatype = tirexResultType::TIREX_STRING,
 		 .example = "1"},
+		// Threads
+		/*[TIREX_CPU_NUM_THREADS_PROCESS] = */
+		{.description = "Number of threads of the tracked process and its children over time.",
+		 .datatype = tirexResultType::TIREX_STRING,
+		 .example = "{max: 64, min: 1, avg: 48, timeseries: {timestamps: [100ms,200ms], values: [1,64]}}"},
+		/*[TIREX_CPU_USED_THREADS_PERCENT] = */
+		{.description = "CPU usage of each thread of the tracked process and its children in percent of a single "
+						"logical CPU core (i.e., 100 means that the thread fully used one core).",
+		 .datatype = tirexResultType::TIREX_STRING,
+		 .example = "{labels: [1234,1235], timeseries: {timestamps: [100ms,200ms], values: [[100,0],[2,98]]}}"},
+		/*[TIREX_CPU_TIME_THREADS_MS] = */
+		{.description = "CPU time (user and system) in milliseconds that each thread spent during tracking.",
+		 .datatype = tirexResultType::TIREX_STRING,
+		 .example = "{1234: 820, 1235: 790}"},
+		/*[TIREX_CPU_THREADS_IMBALANCE] = */
+		{.description = "Summary of the load balance across threads that used the CPU during tracking. The imbalance "
+						"is the CPU time of the busiest thread divided by the mean CPU time of all active threads (1 "
+						"means perfectly balanced).",
+		 .datatype = tirexResultType::TIREX_STRING,
+		 .example = "{threads: 65, active: 64, max_ms: 1210, mean_ms: 1002.4, imbalance: 1.21}"},
+		// Cores
+		/*[TIREX_CPU_USED_CORES_PERCENT] = */
+		{.description = "CPU usage of each logical CPU core in percent.",
+		 .datatype = tirexResultType::TIREX_STRING,
+		 .example = "{labels: [cpu0,cpu1], timeseries: {timestamps: [100ms,200ms], values: [[12,100],[3,97]]}}"},
+		/*[TIREX_CPU_FREQUENCY_CORES_MHZ] = */
+		{.description = "Current speed of each logical CPU core in megahertz.",
+		 .datatype = tirexResultType::TIREX_STRING,
+		 .example = "{labels: [cpu0,cpu1], timeseries: {timestamps: [100ms,200ms], values: [[800,4700],[800,4650]]}}"},
+		/*[TIREX_CPU_ACTIVE_CORES_SYSTEM] = */
+		{.description = "Number of logical CPU cores that were busy for at least 50% of each polling interval.",
+		 .datatype = tirexResultType::TIREX_STRING,
+		 .example = "{max: 16, min: 1, avg: 9, timeseries: {timestamps: [100ms,200ms], values: [1,16]}}"},
+		// Performance Counters
+		/*[TIREX_PERF_CYCLES] = */
+		{.description = "Number of CPU cycles spent by the tracked process and its children.",
+		 .datatype = tirexResultType::TIREX_STRING,
+		 .example = "48512374651"},
+		/*[TIREX_PERF_INSTRUCTIONS] = */
+		{.description = "Number of instructions retired by the tracked process and its children.",
+		 .datatype = tirexResultType::TIREX_STRING,
+		 .example = "97833420112"},
+		/*[TIREX_PERF_CACHE_REFERENCES] = */
+		{.description = "Number of (last level) cache references of the tracked process and its children.",
+		 .datatype = tirexResultType::TIREX_STRING,
+		 .example = "712354210"},
+		/*[TIREX_PERF_CACHE_MISSES] = */
+		{.description = "Number of (last level) cache misses of the tracked process and its children.",
+		 .datatype = tirexResultType::TIREX_STRING,
+		 .example = "80123411"},
+		/*[TIREX_PERF_BRANCH_MISSES] = */
+		{.description = "Number of mispredicted branches of the tracked process and its children.",
+		 .datatype = tirexResultType::TIREX_STRING,
+		 .example = "120456789"},
+		/*[TIREX_PERF_CONTEXT_SWITCHES] = */
+		{.description = "Number of context switches of the tracked process and its children.",
+		 .datatype = tirexResultType::TIREX_STRING,
+		 .example = "5321"},
+		/*[TIREX_PERF_CPU_MIGRATIONS] = */
+		{.description = "Number of migrations between CPUs of the tracked process and its children.",
+		 .datatype = tirexResultType::TIREX_STRING,
+		 .example = "211"},
+		/*[TIREX_PERF_PAGE_FAULTS] = */
+		{.description = "Number of page faults of the tracked process and its children.",
+		 .datatype = tirexResultType::TIREX_STRING,
+		 .example = "48213"},
+		/*[TIREX_PERF_IPC] = */
+		{.description = "Instructions retired per CPU cycle by the tracked process and its children.",
+		 .datatype = tirexResultType::TIREX_STRING,
+		 .example = "2.02"},
+		/*[TIREX_PERF_CACHE_MISS_PERCENT] = */
+		{.description = "Percentage of (last level) cache references that missed the cache.",
+		 .datatype = tirexResultType::TIREX_STRING,
+		 .example = "11.25"},
+		// I/O
+		/*[TIREX_IO_READ_PROCESS_BYTES] = */
+		{.description = "Bytes read by the tracked process and its children using read-like system calls (including "
+						"data served from the page cache).",
+		 .datatype = tirexResultType::TIREX_STRING,
+		 .example = "1073741824"},
+		/*[TIREX_IO_WRITTEN_PROCESS_BYTES] = */
+		{.description = "Bytes written by the tracked process and its children using write-like system calls.",
+		 .datatype = tirexResultType::TIREX_STRING,
+		 .example = "52428800"},
+		/*[TIREX_IO_STORAGE_READ_PROCESS_BYTES] = */
+		{.description = "Bytes the tracked process and its children caused to be fetched from the storage layer.",
+		 .datatype = tirexResultType::TIREX_STRING,
+		 .example = "268435456"},
+		/*[TIREX_IO_STORAGE_WRITTEN_PROCESS_BYTES] = */
+		{.description = "Bytes the tracked process and its children caused to be sent to the storage layer.",
+		 .datatype = tirexResultType::TIREX_STRING,
+		 .example = "52432896"},
+		/*[TIREX_IO_READ_CALLS_PROCESS] = */
+		{.description = "Number of read-like system calls of the tracked process and its children.",
+		 .datatype = tirexResultType::TIREX_STRING,
+		 .example = "131072"},
+		/*[TIREX_IO_WRITE_CALLS_PROCESS] = */
+		{.description = "Number of write-like system calls of the tracked process and its children.",
+		 .datatype = tirexResultType::TIREX_STRING,
+		 .example = "6400"},
+		/*[TIREX_IO_READ_RATE_PROCESS_KBPS] = */
+		{.description = "Read throughput (read-like system calls) of the tracked process and its children in "
+						"kilobytes per second.",
+		 .datatype = tirexResultType::TIREX_STRING,
+		 .example = "{max: 204800, min: 0, avg: 51200, timeseries: {timestamps: [100ms,200ms], values: [0,204800]}}"},
+		/*[TIREX_IO_WRITE_RATE_PROCESS_KBPS] = */
+		{.description = "Write throughput (write-like system calls) of the tracked process and its children in "
+						"kilobytes per second.",
+		 .datatype = tirexResultType::TIREX_STRING,
+		 .example = "{max: 10240, min: 0, avg: 2560, timeseries: {timestamps: [100ms,200ms], values: [0,10240]}}"},
+		/*[TIREX_IO_STORAGE_READ_RATE_PROCESS_KBPS] = */
+		{.description = "Throughput of the data fetched from the storage layer for the tracked process and its "
+						"children in kilobytes per second.",
+		 .datatype = tirexResultType::TIREX_STRING,
+		 .example = "{max: 51200, min: 0, avg: 12800, timeseries: {timestamps: [100ms,200ms], values: [0,51200]}}"},
+		/*[TIREX_IO_STORAGE_WRITE_RATE_PROCESS_KBPS] = */
+		{.description = "Throughput of the data sent to the storage layer by the tracked process and its children in "
+						"kilobytes per second.",
+		 .datatype = tirexResultType::TIREX_STRING,
+		 .example = "{max: 10240, min: 0, avg: 2560, timeseries: {timestamps: [100ms,200ms], values: [0,10240]}}"},
+		// Pressure Stall Information
+		/*[TIREX_PSI_CPU_SOME_PERMYRIAD] = */
+		{.description = "Share of each polling interval in which at least one task was stalled waiting for a "
+						"CPU in hundredths of a percent (permyriad, 10000 = stalled for the whole interval).",
+		 .datatype = tirexResultType::TIREX_STRING,
+		 .example = "{max: 1250, min: 0, avg: 35, timeseries: {timestamps: [100ms,200ms], values: [7,1250]}}"},
+		/*[TIREX_PSI_CPU_FULL_PERMYRIAD] = */
+		{.description = "Share of each polling interval in which all non-idle tasks were stalled waiting for a "
+						"CPU in hundredths of a percent (permyriad, 10000 = stalled for the whole interval).",
+		 .datatype = tirexResultType::TIREX_STRING,
+		 .example = "{max: 1250, min: 0, avg: 35, timeseries: {timestamps: [100ms,200ms], values: [7,1250]}}"},
+		/*[TIREX_PSI_MEMORY_SOME_PERMYRIAD] = */
+		{.description = "Share of each polling interval in which at least one task was stalled waiting for "
+						"memory in hundredths of a percent (permyriad, 10000 = stalled for the whole interval).",
+		 .datatype = tirexResultType::TIREX_STRING,
+		 .example = "{max: 1250, min: 0, avg: 35, timeseries: {timestamps: [100ms,200ms], values: [7,1250]}}"},
+		/*[TIREX_PSI_MEMORY_FULL_PERMYRIAD] = */
+		{.description = "Share of each polling interval in which all non-idle tasks were stalled waiting for "
+						"memory in hundredths of a percent (permyriad, 10000 = stalled for the whole interval).",
+		 .datatype = tirexResultType::TIREX_STRING,
+		 .example = "{max: 1250, min: 0, avg: 35, timeseries: {timestamps: [100ms,200ms], values: [7,1250]}}"},
+		/*[TIREX_PSI_IO_SOME_PERMYRIAD] = */
+		{.description = "Share of each polling interval in which at least one task was stalled waiting for I/O "
+						"in hundredths of a percent (permyriad, 10000 = stalled for the whole interval).",
+		 .datatype = tirexResultType::TIREX_STRING,
+		 .example = "{max: 1250, min: 0, avg: 35, timeseries: {timestamps: [100ms,200ms], values: [7,1250]}}"},
+		/*[TIREX_PSI_IO_FULL_PERMYRIAD] = */
+		{.description = "Share of each polling interval in which all non-idle tasks were stalled waiting for "
+						"I/O in hundredths of a percent (permyriad, 10000 = stalled for the whole interval).",
+		 .datatype = tirexResultType::TIREX_STRING,
+		 .example = "{max: 1250, min: 0, avg: 35, timeseries: {timestamps: [100ms,200ms], values: [7,1250]}}"},
+		/*[TIREX_PSI_CPU_SOME_STALL_MS] = */
+		{.description = "Total time in milliseconds during tracking in which at least one task was stalled waiting "
+						"for a CPU.",
+		 .datatype = tirexResultType::TIREX_STRING,
+		 .example = "1250"},
+		/*[TIREX_PSI_CPU_FULL_STALL_MS] = */
+		{.description = "Total time in milliseconds during tracking in which all non-idle tasks were stalled waiting "
+						"for a CPU.",
+		 .datatype = tirexResultType::TIREX_STRING,
+		 .example = "1250"},
+		/*[TIREX_PSI_MEMORY_SOME_STALL_MS] = */
+		{.description = "Total time in milliseconds during tracking in which at least one task was stalled waiting "
+						"for memory.",
+		 .datatype = tirexResultType::TIREX_STRING,
+		 .example = "1250"},
+		/*[TIREX_PSI_MEMORY_FULL_STALL_MS] = */
+		{.description = "Total time in milliseconds during tracking in which all non-idle tasks were stalled waiting "
+						"for memory.",
+		 .datatype = tirexResultType::TIREX_STRING,
+		 .example = "1250"},
+		/*[TIREX_PSI_IO_SOME_STALL_MS] = */
+		{.description = "Total time in milliseconds during tracking in which at least one task was stalled waiting "
+						"for I/O.",
+		 .datatype = tirexResultType::TIREX_STRING,
+		 .example = "1250"},
+		/*[TIREX_PSI_IO_FULL_STALL_MS] = */
+		{.description = "Total time in milliseconds during tracking in which all non-idle tasks were stalled waiting "
+						"for I/O.",
+		 .datatype = tirexResultType::TIREX_STRING,
+		 .example = "1250"},
+		// Memory Breakdown
+		/*[TIREX_RAM_PSS_PROCESS_KB] = */
+		{.description = "Proportional set size (PSS) of the tracked process and its children in kilobytes, where "
+						"shared pages are divided among all processes that map them.",
+		 .datatype = tirexResultType::TIREX_STRING,
+		 .example = "{max: 8192, min: 4096, avg: 6144, timeseries: {timestamps: [100ms,200ms], values: [4096,8192]}}"},
+		/*[TIREX_RAM_USS_PROCESS_KB] = */
+		{.description = "Unique set size (USS, i.e., private clean and dirty pages) of the tracked process and its "
+						"children in kilobytes.",
+		 .datatype = tirexResultType::TIREX_STRING,
+		 .example = "{max: 6553, min: 3276, avg: 4915, timeseries: {timestamps: [100ms,200ms], values: [3276,6553]}}"},
+		/*[TIREX_RAM_ANON_PROCESS_KB] = */
+		{.description = "Resident anonymous memory (e.g., heap and stack) of the tracked process and its children in "
+						"kilobytes.",
+		 .datatype = tirexResultType::TIREX_STRING,
+		 .example = "{max: 6553, min: 3276, avg: 4915, timeseries: {timestamps: [100ms,200ms], values: [3276,6553]}}"},
+		/*[TIREX_RAM_FILE_PROCESS_KB] = */
+		{.description = "Resident file-backed memory (e.g., mapped index files and libraries) of the tracked process "
+						"and its children in kilobytes.",
+		 .datatype = tirexResultType::TIREX_STRING,
+		 .example = "{max: 10485, min: 819, avg: 5652, timeseries: {timestamps: [100ms,200ms], values: [819,10485]}}"},
+		/*[TIREX_RAM_SHMEM_PROCESS_KB] = */
+		{.description = "Resident shared memory (e.g., shmem and tmpfs mappings) of the tracked process and its "
+						"children in kilobytes.",
+		 .datatype = tirexResultType::TIREX_STRING,
+		 .example = "{max: 1024, min: 0, avg: 512, timeseries: {timestamps: [100ms,200ms], values: [0,1024]}}"},
+		/*[TIREX_RAM_SWAP_PROCESS_KB] = */
+		{.description = "Anonymous memory of the tracked process and its children that was swapped out in kilobytes.",
+		 .datatype = tirexResultType::TIREX_STRING,
+		 .example = "{max: 2048, min: 0, avg: 1024, timeseries: {timestamps: [100ms,200ms], values: [0,2048]}}"},
+		/*[TIREX_RAM_HUGEPAGES_PROCESS_KB] = */
+		{.description = "Anonymous memory of the tracked process and its children that is backed by transparent huge "
+						"pages in kilobytes.",
+		 .datatype = tirexResultType::TIREX_STRING,
+		 .example = "{max: 4096, min: 0, avg: 2048, timeseries: {timestamps: [100ms,200ms], values: [0,4096]}}"},
+		// Page Cache
+		/*[TIREX_PAGECACHE_START] = */
+		{.description = "Page cache residency of the files configured via TIREX_PAGECACHE_PATHS when tracking "
+						"started.",
+		 .datatype = tirexResultType::TIREX_STRING,
+		 .example = "{files: 12, total_mb: 2048, resident_mb: 1536, resident_percent: 75.00}"},
+		/*[TIREX_PAGECACHE_STOP] = */
+		{.description = "Page cache residency of the files configured via TIREX_PAGECACHE_PATHS when tracking "
+						"stopped.",
+		 .datatype = tirexResultType::TIREX_STRING,
+		 .example = "{files: 12, total_mb: 2048, resident_mb: 2048, resident_percent: 100.00}"},
+		/*[TIREX_PAGECACHE_RESIDENT_PERCENT] = */
+		{.description = "Share of the files configured via TIREX_PAGECACHE_PATHS that is resident in the page cache "
+						"in percent. Only sampled if TIREX_PAGECACHE_STEP_INTERVAL is set.",
+		 .datatype = tirexResultType::TIREX_STRING,
+		 .example = "{max: 100, min: 75, avg: 88, timeseries: {timestamps: [100ms,200ms], values: [75,100]}}"},
+		/*[TIREX_PAGECACHE_STATE] = */
+		{.description = "Whether the files configured via TIREX_PAGECACHE_PATHS were in the page cache when tracking "
+						"started: warm (at least 90% resident), cold (at most 10% resident) or partial.",
+		 .datatype = tirexResultType::TIREX_STRING,
+		 .example = "warm"},
+		// Tracked processes
+		/*[TIREX_CPU_USED_PIDS_PERCENT] = */
+		{.description = "The CPU utilization (in percent of a single logical core) of each of the processes that were "
+						"requested to be tracked and their children, labeled by their process ID. "
+						"TIREX_CPU_USED_PROCESS_PERCENT is the sum over all of them.",
+		 .datatype = tirexResultType::TIREX_STRING,
+		 .example = "{labels: [4711,4712], timeseries: {timestamps: [100ms,200ms], values: [[97,3],[100,0]]}}"},
+		/*[TIREX_RAM_USED_PIDS_KB] = */
+		{.description = "The resident set size (in kilobytes) of each of the processes that were requested to be "
+						"tracked and their children, labeled by their process ID. TIREX_RAM_USED_PROCESS_KB is the sum "
+						"over all of them.",
+		 .datatype = tirexResultType::TIREX_STRING,
+		 .example = "{labels: [4711,4712], timeseries: {timestamps: [100ms,200ms], values: [[5120,812],[5312,812]]}}"},
+		// Processes
+		/*[TIREX_PROCESS_TIMELINE] = */
+		{.description = "All processes that were part of the tracked process trees, ordered by their start time, with "
+						"their ID, parent ID, command line, start and exit time (in milliseconds relative to the "
+						"start of the tracking), exit code, CPU time (user and system) in milliseconds, peak resident "
+						"set size and the kilobytes read and written. Exit times and codes are exact if the tracker "
+						"may subscribe to process events (proc connector) and sampled otherwise.",
+		 .datatype = tirexResultType::TIREX_STRING,
+		 .example = "[{pid: 4711, ppid: 4710, command: \"sort -u terms.txt\", start_ms: 12, exit_ms: 950, "
+					"exit_code: 0, cpu_ms: 912, peak_rss_kb: 10240, read_kb: 5120, write_kb: 4096}]"},
+		/*[TIREX_PROCESS_COUNT] = */
+		{.description = "The number of processes that were part of the tracked process trees, i.e., the number of "
+						"entries in TIREX_PROCESS_TIMELINE.",
+		 .datatype = tirexResultType::TIREX_STRING,
+		 .example = "42"},
+		// Idle states and thermals
+		/*[TIREX_CPU_IDLE_STATES] = */
+		{.description = "For each CPU idle state (C-state), the share of the available CPU time (elapsed time times "
+						"the number of logical CPUs) that was spent in the state in percent and how often the state "
+						"was entered while tracking.",
+		 .datatype = tirexResultType::TIREX_STRING,
+		 .example = "{POLL: {residency_percent: 0.01, entries: 12}, C1: {residency_percent: 2.10, entries: 5210}}"},
+		/*[TIREX_CPU_IDLE_PERCENT] = */
+		{.description = "The share of the available CPU time that all logical CPUs spent in any idle state in "
+						"percent. Only reported if TIREX_THERMAL_STEP_INTERVAL is set.",
+		 .datatype = tirexResultType::TIREX_STRING,
+		 .example = "{max: 99, min: 12, avg: 64, timeseries: {timestamps: [100ms,200ms], values: [99,12]}}"},
+		/*[TIREX_CPU_THROTTLE_EVENTS] = */
+		{.description = "How often the CPU cores and packages were throttled since they got too hot and, if supported "
+						"by the kernel, for how many milliseconds.",
+		 .datatype = tirexResultType::TIREX_STRING,
+		 .example = "{core: 3, package: 1, core_ms: 120, package_ms: 40}"},
+		/*[TIREX_THERMAL_ZONES_CELSIUS] = */
+		{.description = "The type and temperature (in degrees Celsius) of each thermal zone when tracking started and "
+						"stopped and the maximum of all samples.",
+		 .datatype = tirexResultType::TIREX_STRING,
+		 .example = "{thermal_zone0: {type: x86_pkg_temp, start: 45.0, stop: 71.0, max: 73.0}}"},
+		// Scheduler
+		/*[TIREX_CPU_RUN_TIME_PROCESS_MS] = */
+		{.description = "The time that all threads of the tracked processes and their children spent running on a CPU "
+						"in milliseconds as accounted by the scheduler.",
+		 .datatype = tirexResultType::TIREX_STRING,
+		 .example = "12345"},
+		/*[TIREX_CPU_WAIT_TIME_PROCESS_MS] = */
+		{.description = "The time that all threads of the tracked processes and their children were runnable but had "
+						"to wait for a CPU (run-queue delay) in milliseconds. A high value indicates that the machine "
+						"is oversubscribed.",
+		 .datatype = tirexResultType::TIREX_STRING,
+		 .example = "230"},
+		/*[TIREX_CPU_TIMESLICES_PROCESS] = */
+		{.description = "The number of timeslices that all threads of the tracked processes and their children ran on "
+						"a CPU.",
+		 .datatype = tirexResultType::TIREX_STRING,
+		 .example = "5210"},
+		/*[TIREX_CPU_WAIT_PROCESS_PERCENT] = */
+		{.description = "The share of the time the threads of the tracked processes and their children were runnable "
+						"that they spent waiting for a CPU in percent.",
+		 .datatype = tirexResultType::TIREX_STRING,
+		 .example = "{max: 99, min: 12, avg: 64, timeseries: {timestamps: [100ms,200ms], values: [99,12]}}"},
+		/*[TIREX_IO_BLOCK_DELAY_PROCESS_MS] = */
+		{.description = "The time that all threads of the tracked processes and their children spent waiting for "
+						"block I/O to complete in milliseconds. Only reported if the kernel's delay accounting is "
+						"enabled.",
+		 .datatype = tirexResultType::TIREX_STRING,
+		 .example = "42"},
+		// Energy
+		/*[TIREX_ENERGY_DOMAINS_JOULES] = */
+		{.description = "The energy consumed by each RAPL domain (e.g., package, core, uncore, dram and psys) over "
+						"the tracked period in joules. Subdomains are suffixed with the package they belong to. "
+						"Domains whose energy counter cannot be read (usually without root privileges) are left out.",
+		 .datatype = tirexResultType::TIREX_STRING,
+		 .example = "{package-0: 1520.125, core-0: 1210.500, uncore-0: 3.250, dram-0: 98.750, psys: 1801.000}"},
+		/*[TIREX_POWER_DOMAINS_WATTS] = */
+		{.description = "The average power drawn by each RAPL domain since the previous polling step in watts, "
+						"labeled by the domain.",
+		 .datatype = tirexResultType::TIREX_STRING,
+		 .example = "{labels: [package-0,dram-0], timeseries: {timestamps: [100ms,200ms], values: [[65,4],[71,5]]}}"},
+		// Attributed energy
+		/*[TIREX_CPU_ENERGY_PROCESS_JOULES] = */
+		{.description = "The CPU package energy (see TIREX_CPU_ENERGY_SYSTEM_JOULES) attributed to the tracked "
+						"processes and their children in joules. The energy consumed between two polling steps is "
+						"split by the share the tracked processes had in the CPU time all processes spent during that "
+						"interval.",
+		 .datatype = tirexResultType::TIREX_STRING,
+		 .example = "1234.567"},
+		/*[TIREX_RAM_ENERGY_PROCESS_JOULES] = */
+		{.description = "The DRAM energy (see TIREX_RAM_ENERGY_SYSTEM_JOULES) attributed to the tracked processes and "
+						"their children in joules. The energy consumed between two polling steps is split by the "
+						"share the tracked processes had in the CPU time all processes spent during that interval.",
+		 .datatype = tirexResultType::TIREX_STRING,
+		 .example = "80.125"},
+		// Estimated energy
+		/*[TIREX_CPU_ENERGY_ESTIMATED_JOULES] = */
+		{.description = "An estimate (not a measurement) of the energy consumed by the CPUs of the entire system over "
+						"the tracked period in joules. It is computed from the utilization and current frequency of "
+						"each logical CPU using the linear power model reported as TIREX_CPU_POWER_MODEL and is also "
+						"available if no energy counters are.",
+		 .datatype = tirexResultType::TIREX_STRING,
+		 .example = "1480.250"},
+		/*[TIREX_CPU_POWER_ESTIMATED_WATTS] = */
+		{.description = "An estimate (not a measurement) of the average power drawn by the CPUs of the entire system "
+						"since the previous polling step in watts (see TIREX_CPU_ENERGY_ESTIMATED_JOULES).",
+		 .datatype = tirexResultType::TIREX_STRING,
+		 .example = "{max: 99, min: 12, avg: 64, timeseries: {timestamps: [100ms,200ms], values: [99,12]}}"},
+		/*[TIREX_CPU_POWER_MODEL] = */
+		{.description = "The idle and maximum power (in watts) of the linear power model that "
+						"TIREX_CPU_ENERGY_ESTIMATED_JOULES is based on and whether they were configured, derived from "
+						"the RAPL power limit or are a rough default.",
+		 .datatype = tirexResultType::TIREX_STRING,
+		 .example = "{idle_watts: 19.5, max_watts: 65.0, source: rapl}"},
+		// GPU devices
+		/*[TIREX_GPU_USED_DEVICES_PERCENT] = */
+		{.description = "GPU utilization of the entire system in percent, labeled by the index of the GPU.",
+		 .datatype = tirexResultType::TIREX_STRING,
+		 .example = "{labels: [0,1], timeseries: {timestamps: [100ms,200ms], values: [[97,3],[100,0]]}}"},
+		/*[TIREX_GPU_USED_PROCESS_DEVICES_PERCENT] = */
+		{.description = "SM utilization of each GPU caused by the tracked process and its children in percent, "
+						"labeled by the index of the GPU.",
+		 .datatype = tirexResultType::TIREX_STRING,
+		 .example = "{labels: [0,1], timeseries: {timestamps: [100ms,200ms], values: [[97,0],[100,0]]}}"},
+		/*[TIREX_GPU_VRAM_USED_DEVICES_MB] = */
+		{.description = "GPU VRAM usage of the entire system in megabytes, labeled by the index of the GPU.",
+		 .datatype = tirexResultType::TIREX_STRING,
+		 .example = "{labels: [0,1], timeseries: {timestamps: [100ms,200ms], values: [[2048,12],[4096,12]]}}"},
+		/*[TIREX_GPU_VRAM_USED_PROCESS_DEVICES_MB] = */
+		{.description = "GPU VRAM usage of the tracked process and its children in megabytes, labeled by the index of "
+						"the GPU.",
+		 .datatype = tirexResultType::TIREX_STRING,
+		 .example = "{labels: [0,1], timeseries: {timestamps: [100ms,200ms], values: [[2000,0],[4000,0]]}}"},
+		// GPU driver samples
+		/*[TIREX_GPU_USED_SAMPLES_PERCENT] = */
+		{.description = "GPU utilization of the entire system in percent as sampled by the driver, labeled by the "
+						"index of the GPU. Only reported if TIREX_GPU_SAMPLES_STEP_INTERVAL is set.",
+		 .datatype = tirexResultType::TIREX_STRING,
+		 .example = "{labels: [0], timeseries: {timestamps: [16ms,183ms], values: [[97],[100]]}}"},
+		/*[TIREX_GPU_MEMORY_USED_SAMPLES_PERCENT] = */
+		{.description = "Utilization of the GPU's memory controller (the share of time memory was read or written) in "
+						"percent as sampled by the driver, labeled by the index of the GPU. Only reported if "
+						"TIREX_GPU_SAMPLES_STEP_INTERVAL is set.",
+		 .datatype = tirexResultType::TIREX_STRING,
+		 .example = "{labels: [0], timeseries: {timestamps: [16ms,183ms], values: [[40],[42]]}}"},
+		/*[TIREX_GPU_POWER_SAMPLES_WATTS] = */
+		{.description = "Power drawn by each GPU in watts as sampled by the driver, labeled by the index of the GPU. "
+						"Only reported if TIREX_GPU_SAMPLES_STEP_INTERVAL is set.",
+		 .datatype = tirexResultType::TIREX_STRING,
+		 .example = "{labels: [0], timeseries: {timestamps: [20ms,40ms], values: [[250],[262]]}}"},
+		// GPU device metrics
+		/*[TIREX_GPU_CLOCK_SM_MHZ] = */
+		{.description = "The clock of the streaming multiprocessors of each GPU in MHz, labeled by the index of the "
+						"GPU.",
+		 .datatype = tirexResultType::TIREX_STRING,
+		 .example = "{labels: [0,1], timeseries: {timestamps: [100ms,200ms], values: [[1980,210],[1980,1410]]}}"},
+		/*[TIREX_GPU_CLOCK_MEMORY_MHZ] = */
+		{.description = "The memory clock of each GPU in MHz, labeled by the index of the GPU.",
+		 .datatype = tirexResultType::TIREX_STRING,
+		 .example = "{labels: [0,1], timeseries: {timestamps: [100ms,200ms], values: [[1593,405],[1593,1593]]}}"},
+		/*[TIREX_GPU_POWER_WATTS] = */
+		{.description = "The power drawn by each GPU in watts, labeled by the index of the GPU.",
+		 .datatype = tirexResultType::TIREX_STRING,
+		 .example = "{labels: [0,1], timeseries: {timestamps: [100ms,200ms], values: [[310,62],[305,180]]}}"},
+		/*[TIREX_GPU_TEMPERATURE_CELSIUS] = */
+		{.description = "The temperature of the die of each GPU in degrees Celsius, labeled by the index of the GPU.",
+		 .datatype = tirexResultType::TIREX_STRING,
+		 .example = "{labels: [0,1], timeseries: {timestamps: [100ms,200ms], values: [[71,38],[72,45]]}}"},
+		/*[TIREX_GPU_MEMORY_TEMPERATURE_CELSIUS] = */
+		{.description = "The temperature of the memory (HBM) of each GPU in degrees Celsius, labeled by the index of "
+						"the GPU. Only reported if at least one GPU supports it.",
+		 .datatype = tirexResultType::TIREX_STRING,
+		 .example = "{labels: [0,1], timeseries: {timestamps: [100ms,200ms], values: [[80,40],[81,47]]}}"},
+		/*[TIREX_GPU_PCIE_TX_KBPS] = */
+		{.description = "The throughput the GPU transmitted over PCIe (i.e., to the host) in KB/s, labeled by the "
+						"index of the GPU.",
+		 .datatype = tirexResultType::TIREX_STRING,
+		 .example = "{labels: [0,1], timeseries: {timestamps: [100ms,200ms], values: [[1024,0],[52000,12]]}}"},
+		/*[TIREX_GPU_PCIE_RX_KBPS] = */
+		{.description = "The throughput the GPU received over PCIe (i.e., from the host) in KB/s, labeled by the "
+						"index of the GPU.",
+		 .datatype = tirexResultType::TIREX_STRING,
+		 .example = "{labels: [0,1], timeseries: {timestamps: [100ms,200ms], values: [[880000,0],[4096,12]]}}"},
+		/*[TIREX_GPU_THROTTLE_REASONS] = */
+		{.description = "For each GPU, the number of polling steps in which its clocks were queried (steps) and in "
+						"which they were reduced for the given reasons (e.g., sw_power_cap or hw_thermal_slowdown) as "
+						"well as the time in milliseconds the clocks were reduced due to the power and thermal "
+						"policies if supported.",
+		 .datatype = tirexResultType::TIREX_STRING,
+		 .example = "{0: {steps: 50,sw_power_cap: 12,power_policy_ms: 1200,thermal_policy_ms: 30}}"},
+		// Git consistency
+		/*[TIREX_GIT_CHANGED_DURING_RUN] = */
+		{.description = "1 if HEAD, the index or any of the files that make up the git hash changed between the start "
+						"and the end of tracking, such that the git information may not describe the state the "
+						"program ran on, and 0 otherwise. Only reported when the git measures are collected while "
+						"tracking (see TIREX_GIT_BACKGROUND) and not on Windows.",
+		 .datatype = tirexResultType::TIREX_STRING,
+		 .example = "0"},
+		// CPU topology
+		/*[TIREX_CPU_CORE_TYPES] = */
+		{.description = "The kinds of cores of heterogeneous CPUs (e.g., hybrid Intel or big.LITTLE ARM CPUs), "
+						"ordered from the fastest to the slowest: the number of physical cores, the IDs of the "
+						"logical processors and their frequency ranges in megahertz (mapped to the processors that "
+						"have them). The type is default if all cores are alike.",
+		 .datatype = tirexResultType::TIREX_STRING,
+		 .example = "[{type: performance, cores: 8, processors: [0-15], frequency_mhz: {800-5400: [0-15]}}, "
+					"{type: efficiency, cores: 8, processors: [16-23], frequency_mhz: {800-4300: [16-23]}}]"},
+		/*[TIREX_CPU_CACHE_TOPOLOGY] = */
+		{.description = "For each cache level, the distinct kinds of cache instances: their size in kibibytes, the "
+						"number of logical processors that share an instance and how many such instances exist.",
+		 .datatype = tirexResultType::TIREX_STRING,
+		 .example = "{l1d: [{size_kib: 32, shared_by: 1, count: 8}, {size_kib: 48, shared_by: 2, count: 8}], "
+					"l2: [{size_kib: 1280, shared_by: 2, count: 8}, {size_kib: 2048, shared_by: 4, count: 2}], "
+					"l3: [{size_kib: 30720, shared_by: 24, count: 1}]}"},
+		/*[TIREX_CPU_NUMA_NODES] = */
+		{.description = "The NUMA nodes of the system with the IDs of their logical processors and their memory in "
+						"megabytes (Linux only).",
+		 .datatype = tirexResultType::TIREX_STRING,
+		 .example = "[{node: 0, processors: [0-23], memory_mb: 33554}, "
+					"{node: 1, processors: [24-47], memory_mb: 33554}]"},
+		/*[TIREX_CPU_USED_CORE_TYPES_PERCENT] = */
+		{.description = "The average CPU usage of the logical processors of each kind of core in percent, labeled by "
+						"the type (see TIREX_CPU_CORE_TYPES). Only available on Linux.",
+		 .datatype = tirexResultType::TIREX_STRING,
+		 .example = "{labels: [performance,efficiency], timeseries: {timestamps: [100ms,200ms], "
+					"values: [[96,3],[98,12]]}}"},
+		// Pressure Stall Information (kernel averages)
+		/*[TIREX_PSI_CPU_SOME_AVG10_PERMYRIAD] = */
+		{.description = "The kernel's running average (avg10) of the share of the last 10 seconds in which "
+						"at least one task was stalled waiting for a CPU at each polling interval in hundredths "
+						"of a percent.",
+		 .datatype = tirexResultType::TIREX_STRING,
+		 .example = "{max: 1250, min: 0, avg: 35, timeseries: {timestamps: [100ms,200ms], values: [7,1250]}}"},
+		/*[TIREX_PSI_CPU_FULL_AVG10_PERMYRIAD] = */
+		{.description = "The kernel's running average (avg10) of the share of the last 10 seconds in which "
+						"all non-idle tasks were stalled waiting for a CPU at each polling interval in hundredths "
+						"of a percent.",
+		 .datatype = tirexResultType::TIREX_STRING,
+		 .example = "{max: 1250, min: 0, avg: 35, timeseries: {timestamps: [100ms,200ms], values: [7,1250]}}"},
+		/*[TIREX_PSI_MEMORY_SOME_AVG10_PERMYRIAD] = */
+		{.description = "The kernel's running average (avg10) of the share of the last 10 seconds in which "
+						"at least one task was stalled waiting for memory at each polling interval in hundredths "
+						"of a percent.",
+		 .datatype = tirexResultType::TIREX_STRING,
+		 .example = "{max: 1250, min: 0, avg: 35, timeseries: {timestamps: [100ms,200ms], values: [7,1250]}}"},
+		/*[TIREX_PSI_MEMORY_FULL_AVG10_PERMYRIAD] = */
+		{.description = "The kernel's running average (avg10) of the share of the last 10 seconds in which "
+						"all non-idle tasks were stalled waiting for memory at each polling interval in hundredths "
+						"of a percent.",
+		 .datatype = tirexResultType::TIREX_STRING,
+		 .example = "{max: 1250, min: 0, avg: 35, timeseries: {timestamps: [100ms,200ms], values: [7,1250]}}"},
+		/*[TIREX_PSI_IO_SOME_AVG10_PERMYRIAD] = */
+		{.description = "The kernel's running average (avg10) of the share of the last 10 seconds in which "
+						"at least one task was stalled waiting for I/O at each polling interval in hundredths "
+						"of a percent.",
+		 .datatype = tirexResultType::TIREX_STRING,
+		 .example = "{max: 1250, min: 0, avg: 35, timeseries: {timestamps: [100ms,200ms], values: [7,1250]}}"},
+		/*[TIREX_PSI_IO_FULL_AVG10_PERMYRIAD] = */
+		{.description = "The kernel's running average (avg10) of the share of the last 10 seconds in which "
+						"all non-idle tasks were stalled waiting for I/O at each polling interval in hundredths "
+						"of a percent.",
+		 .datatype = tirexResultType::TIREX_STRING,
+		 .example = "{max: 1250, min: 0, avg: 35, timeseries: {timestamps: [100ms,200ms], values: [7,1250]}}"},
+		// Scheduler (per step)
+		/*[TIREX_CPU_RUN_TIME_STEPS_PROCESS_MS] = */
+		{.description = "The time in milliseconds that all threads of the tracked processes and their children spent "
+						"running on a CPU during each polling interval (see TIREX_CPU_RUN_TIME_PROCESS_MS).",
+		 .datatype = tirexResultType::TIREX_STRING,
+		 .example = "{max: 400, min: 12, avg: 230, timeseries: {timestamps: [100ms,200ms], values: [12,400]}}"},
+		/*[TIREX_CPU_WAIT_TIME_STEPS_PROCESS_MS] = */
+		{.description = "The time in milliseconds that all threads of the tracked processes and their children were "
+						"runnable but had to wait for a CPU during each polling interval (see "
+						"TIREX_CPU_WAIT_TIME_PROCESS_MS).",
+		 .datatype = tirexResultType::TIREX_STRING,
+		 .example = "{max: 85, min: 0, avg: 20, timeseries: {timestamps: [100ms,200ms], values: [0,85]}}"},
+		/*[TIREX_CPU_TIMESLICES_STEPS_PROCESS] = */
+		{.description = "The number of timeslices that all threads of the tracked processes and their children ran on "
+						"a CPU during each polling interval (see TIREX_CPU_TIMESLICES_PROCESS).",
+		 .datatype = tirexResultType::TIREX_STRING,
+		 .example = "{max: 310, min: 25, avg: 120, timeseries: {timestamps: [100ms,200ms], values: [25,310]}}"},
 };
 
 tirexError tirexMeasureInfoGet(tirexMeasure measure, const tirexMeasureInfo** info) {
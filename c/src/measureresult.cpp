@@ -56,6 +56,25 @@ static std::string toYAML(const tirex::TimeSeries<T>& timeseries) {
 	);
 }
 
+template <typename T>
+static std::string toYAML(const tirex::TimeSeriesMatrix<T>& matrix) {
+	const auto& [timestamps, rows] = matrix.timeseries();
+	std::string values;
+	for (const auto& row : rows) {
+		if (!values.empty())
+			values += ',';
+		values += '[' + tirex::utils::join(row, ',');
+		// Columns that were added after this row was recorded are reported as zero
+		for (auto i = row.size(); i < matrix.numColumns(); ++i)
+			values += (i == 0) ? "0" : ",0";
+		values += ']';
+	}
+	return _fmt::format(
+			"{{labels: [{}], timeseries: {{timestamps: [{}], values: [{}]}}}}",
+			tirex::utils::join(matrix.columnLabels(), ','), tirex::utils::join(timestamps, ','), values
+	);
+}
+
 extern tirexResult_st* tirex::createMsrResultFromStats(tirex::Stats&& stats) {
 	std::vector<std::pair<tirexMeasure, std::string>> result;
 	for (auto&& [key, value] : stats) {
@@ -64,6 +83,9 @@ extern tirexResult_st* tirex::createMsrResultFromStats(tirex::Stats&& stats) {
 						[key, &result](std::string& str) { result.emplace_back(key, std::move(str)); },
 						[key, &result](const tirex::TimeSeries<unsigned>& timeseries) {
 							result.emplace_back(key, toYAML(timeseries));
+						},
+						[key, &result](const tirex::TimeSeriesMatrix<unsigned>& matrix) {
+							result.emplace_back(key, toYAML(matrix));
 						}
 				},
 				value
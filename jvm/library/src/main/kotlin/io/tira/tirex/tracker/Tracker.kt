@@ -51,7 +51,35 @@ enum class Measure(val value: Int) {
     GPU_ENERGY_SYSTEM_JOULES(33), GIT_IS_REPO(34), GIT_HASH(35), GIT_LAST_COMMIT_HASH(36), GIT_BRANCH(37), GIT_BRANCH_UPSTREAM(
         38
     ),
-    GIT_TAGS(39), GIT_REMOTE_ORIGIN(40), GIT_UNCOMMITTED_CHANGES(41), GIT_UNPUSHED_CHANGES(42), GIT_UNCHECKED_FILES(43), JAVA_VERSION(
+    GIT_TAGS(39), GIT_REMOTE_ORIGIN(40), GIT_UNCOMMITTED_CHANGES(41), GIT_UNPUSHED_CHANGES(42), GIT_UNCHECKED_FILES(43),
+    CPU_NUM_THREADS_PROCESS(44), CPU_USED_THREADS_PERCENT(45), CPU_TIME_THREADS_MS(46), CPU_THREADS_IMBALANCE(47),
+    CPU_USED_CORES_PERCENT(48), CPU_FREQUENCY_CORES_MHZ(49), CPU_ACTIVE_CORES_SYSTEM(50), PERF_CYCLES(51),
+    PERF_INSTRUCTIONS(52), PERF_CACHE_REFERENCES(53), PERF_CACHE_MISSES(54), PERF_BRANCH_MISSES(55),
+    PERF_CONTEXT_SWITCHES(56), PERF_CPU_MIGRATIONS(57), PERF_PAGE_FAULTS(58), PERF_IPC(59), PERF_CACHE_MISS_PERCENT(60),
+    IO_READ_PROCESS_BYTES(61), IO_WRITTEN_PROCESS_BYTES(62), IO_STORAGE_READ_PROCESS_BYTES(63),
+    IO_STORAGE_WRITTEN_PROCESS_BYTES(64), IO_READ_CALLS_PROCESS(65), IO_WRITE_CALLS_PROCESS(66),
+    IO_READ_RATE_PROCESS_KBPS(67), IO_WRITE_RATE_PROCESS_KBPS(68), IO_STORAGE_READ_RATE_PROCESS_KBPS(69),
+    IO_STORAGE_WRITE_RATE_PROCESS_KBPS(70), PSI_CPU_SOME_PERMYRIAD(71), PSI_CPU_FULL_PERMYRIAD(72),
+    PSI_MEMORY_SOME_PERMYRIAD(73), PSI_MEMORY_FULL_PERMYRIAD(74), PSI_IO_SOME_PERMYRIAD(75), PSI_IO_FULL_PERMYRIAD(76),
+    PSI_CPU_SOME_STALL_MS(77), PSI_CPU_FULL_STALL_MS(78), PSI_MEMORY_SOME_STALL_MS(79), PSI_MEMORY_FULL_STALL_MS(80),
+    PSI_IO_SOME_STALL_MS(81), PSI_IO_FULL_STALL_MS(82), RAM_PSS_PROCESS_KB(83), RAM_USS_PROCESS_KB(84),
+    RAM_ANON_PROCESS_KB(85), RAM_FILE_PROCESS_KB(86), RAM_SHMEM_PROCESS_KB(87), RAM_SWAP_PROCESS_KB(88),
+    RAM_HUGEPAGES_PROCESS_KB(89), PAGECACHE_START(90), PAGECACHE_STOP(91), PAGECACHE_RESIDENT_PERCENT(92),
+    PAGECACHE_STATE(93), CPU_USED_PIDS_PERCENT(94), RAM_USED_PIDS_KB(95), PROCESS_TIMELINE(96), PROCESS_COUNT(97),
+    CPU_IDLE_STATES(98), CPU_IDLE_PERCENT(99), CPU_THROTTLE_EVENTS(100), THERMAL_ZONES_CELSIUS(101),
+    CPU_RUN_TIME_PROCESS_MS(102), CPU_WAIT_TIME_PROCESS_MS(103), CPU_TIMESLICES_PROCESS(104),
+    CPU_WAIT_PROCESS_PERCENT(105), IO_BLOCK_DELAY_PROCESS_MS(106), ENERGY_DOMAINS_JOULES(107), POWER_DOMAINS_WATTS(108),
+    CPU_ENERGY_PROCESS_JOULES(109), RAM_ENERGY_PROCESS_JOULES(110), CPU_ENERGY_ESTIMATED_JOULES(111),
+    CPU_POWER_ESTIMATED_WATTS(112), CPU_POWER_MODEL(113), GPU_USED_DEVICES_PERCENT(114),
+    GPU_USED_PROCESS_DEVICES_PERCENT(115), GPU_VRAM_USED_DEVICES_MB(116), GPU_VRAM_USED_PROCESS_DEVICES_MB(117),
+    GPU_USED_SAMPLES_PERCENT(118), GPU_MEMORY_USED_SAMPLES_PERCENT(119), GPU_POWER_SAMPLES_WATTS(120),
+    GPU_CLOCK_SM_MHZ(121), GPU_CLOCK_MEMORY_MHZ(122), GPU_POWER_WATTS(123), GPU_TEMPERATURE_CELSIUS(124),
+    GPU_MEMORY_TEMPERATURE_CELSIUS(125), GPU_PCIE_TX_KBPS(126), GPU_PCIE_RX_KBPS(127), GPU_THROTTLE_REASONS(128),
+    GIT_CHANGED_DURING_RUN(129), CPU_CORE_TYPES(130), CPU_CACHE_TOPOLOGY(131), CPU_NUMA_NODES(132),
+    CPU_USED_CORE_TYPES_PERCENT(133), PSI_CPU_SOME_AVG10_PERMYRIAD(134), PSI_CPU_FULL_AVG10_PERMYRIAD(135),
+    PSI_MEMORY_SOME_AVG10_PERMYRIAD(136), PSI_MEMORY_FULL_AVG10_PERMYRIAD(137), PSI_IO_SOME_AVG10_PERMYRIAD(138),
+    PSI_IO_FULL_AVG10_PERMYRIAD(139), CPU_RUN_TIME_STEPS_PROCESS_MS(140), CPU_WAIT_TIME_STEPS_PROCESS_MS(141),
+    CPU_TIMESLICES_STEPS_PROCESS(142), JAVA_VERSION(
         2001
     ),
     JAVA_VERSION_DATE(2002), JAVA_VENDOR(2003), JAVA_VENDOR_URL(2004), JAVA_VENDOR_VERSION(2005), JAVA_HOME(2006), JAVA_VM_SPECIFICATION_VERSION(
@@ -438,6 +466,14 @@ private interface TrackerLibrary : Library {
         measures: Array<NativeMeasureConfiguration>, pollIntervalMs: LibCAPI.size_t, handle: Pointer
     ): Int
 
+    fun tirexStartTrackingPids(
+        measures: Array<NativeMeasureConfiguration>,
+        pids: IntArray?,
+        numPids: LibCAPI.size_t,
+        pollIntervalMs: LibCAPI.size_t,
+        handle: Pointer
+    ): Int
+
     fun tirexStopTracking(handle: Pointer, result: Pointer): Int
     fun tirexSetLogCallback(callback: NativeLogCallback)
     fun tirexDataProviderGetAll(buffer: Array<NativeProviderInfo>?, bufferSize: LibCAPI.size_t): LibCAPI.size_t
@@ -593,6 +629,7 @@ class TrackingHandle private constructor(
             systemDescription: String? = null,
             exportFilePath: File? = null,
             exportFormat: ExportFormat? = null,
+            pids: Collection<Long> = emptyList(),
         ): TrackingHandle {
             // Get Java info first, and then strip Java measures from the list.
             val (javaInfo, remainingMeasures) = getJavaInfo(measures)
@@ -607,10 +644,19 @@ class TrackingHandle private constructor(
                 resultPointer.getPointer(0)
             }
 
-            // Start the tracking.
+            // Start the tracking (of the given processes or, if there are none, of this process).
             val trackingHandle = usePointer { measurementHandlePointer ->
-                val errorInt =
+                val errorInt = if (pids.isEmpty()) {
                     LIBRARY.tirexStartTracking(configArray, LibCAPI.size_t(pollIntervalMillis), measurementHandlePointer)
+                } else {
+                    LIBRARY.tirexStartTrackingPids(
+                        configArray,
+                        pids.map { it.toInt() }.toIntArray(),
+                        LibCAPI.size_t(pids.size.toLong()),
+                        LibCAPI.size_t(pollIntervalMillis),
+                        measurementHandlePointer,
+                    )
+                }
                 handleError(errorInt)
                 measurementHandlePointer.getPointer(0)
             }
@@ -637,6 +683,7 @@ class TrackingHandle private constructor(
             systemDescription: String? = null,
             exportFilePath: Path,
             exportFormat: ExportFormat? = null,
+            pids: Collection<Long> = emptyList(),
         ): TrackingHandle = start(
             measures = measures,
             pollIntervalMillis = pollIntervalMillis,
@@ -644,6 +691,7 @@ class TrackingHandle private constructor(
             systemDescription = systemDescription,
             exportFilePath = exportFilePath.toFile(),
             exportFormat = exportFormat,
+            pids = pids,
         )
     }
 
@@ -778,6 +826,7 @@ fun startTracking(
     systemDescription: String? = null,
     exportFilePath: File? = null,
     exportFormat: ExportFormat? = null,
+    pids: Collection<Long> = emptyList(),
 ) = TrackingHandle.start(
     measures = measures,
     pollIntervalMillis = pollIntervalMillis,
@@ -785,6 +834,7 @@ fun startTracking(
     systemDescription = systemDescription,
     exportFilePath = exportFilePath,
     exportFormat = exportFormat,
+    pids = pids,
 )
 
 @Suppress("unused")
@@ -796,6 +846,7 @@ fun startTracking(
     systemDescription: String? = null,
     exportFilePath: Path,
     exportFormat: ExportFormat? = null,
+    pids: Collection<Long> = emptyList(),
 ) = startTracking(
     measures = measures,
     pollIntervalMillis = pollIntervalMillis,
@@ -803,6 +854,7 @@ fun startTracking(
     systemDescription = systemDescription,
     exportFilePath = exportFilePath.toFile(),
     exportFormat = exportFormat,
+    pids = pids,
 )
 
 
@@ -817,6 +869,7 @@ fun tracking(
     systemDescription: String? = null,
     exportFilePath: File? = null,
     exportFormat: ExportFormat? = null,
+    pids: Collection<Long> = emptyList(),
 ) = TrackingHandle.start(
     measures = measures,
     pollIntervalMillis = pollIntervalMillis,
@@ -824,6 +877,7 @@ fun tracking(
     systemDescription = systemDescription,
     exportFilePath = exportFilePath,
     exportFormat = exportFormat,
+    pids = pids,
 )
 
 @Suppress("unused")
@@ -835,6 +889,7 @@ fun tracking(
     systemDescription: String? = null,
     exportFilePath: Path,
     exportFormat: ExportFormat? = null,
+    pids: Collection<Long> = emptyList(),
 ) = tracking(
     measures = measures,
     pollIntervalMillis = pollIntervalMillis,
@@ -842,6 +897,7 @@ fun tracking(
     systemDescription = systemDescription,
     exportFilePath = exportFilePath.toFile(),
     exportFormat = exportFormat,
+    pids = pids,
 )
 
 @JvmOverloads
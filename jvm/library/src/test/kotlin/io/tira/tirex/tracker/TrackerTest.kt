@@ -1,5 +1,6 @@
 package io.tira.tirex.tracker
 
+import org.junit.Assume.assumeTrue
 import org.junit.Test
 import kotlin.io.path.ExperimentalPathApi
 import kotlin.io.path.createTempDirectory
@@ -88,6 +89,31 @@ class TrackerTest {
         assertTrue { timeElapsed > 0.0 }
     }
 
+    @Test
+    fun testMeasureStartAndStopPids() {
+        // The usage of each tracked process is only reported on Linux.
+        assumeTrue(System.getProperty("os.name").startsWith("Linux"))
+        val child = ProcessBuilder("sleep", "1").start()
+        val actual = try {
+            val ref = startTracking(
+                setOf(Measure.CPU_USED_PIDS_PERCENT, Measure.RAM_USED_PIDS_KB), pids = listOf(child.pid())
+            )
+            Thread.sleep(100)
+            stopTracking(ref)
+        } finally {
+            child.destroyForcibly().waitFor()
+        }
+
+        for (measure in listOf(Measure.CPU_USED_PIDS_PERCENT, Measure.RAM_USED_PIDS_KB)) {
+            assertContains(actual.keys, measure)
+            val resultEntry = actual[measure]
+            assertNotNull(resultEntry)
+            assertNotNull(resultEntry.value)
+            // The series are labeled by the IDs of the tracked processes.
+            assertContains(resultEntry.value, "labels: [${child.pid()}]")
+        }
+    }
+
     @Test
     fun testMeasureUsingUseStatement() {
         val tracked = TrackingHandle.start(setOf(Measure.TIME_ELAPSED_WALL_CLOCK_MS))
@@ -1,8 +1,11 @@
 from pathlib import Path
+from subprocess import Popen
+from sys import platform
 from tempfile import TemporaryDirectory
 from time import sleep
 from typing import Collection, Mapping
 
+from pytest import mark
 from tirex_tracker import (
     provider_infos,
     measure_infos,
@@ -90,6 +93,33 @@ def test_measure_start_and_stop() -> None:
     assert time_elapsed > 0.0
 
 
+@mark.skipif(
+    platform != "linux",
+    reason="The usage of each tracked process is only reported on Linux.",
+)
+def test_measure_start_and_stop_pids() -> None:
+    child = Popen(["sleep", "1"])
+    try:
+        ref = start_tracking(
+            [Measure.CPU_USED_PIDS_PERCENT, Measure.RAM_USED_PIDS_KB],
+            pids=[child.pid],
+        )
+        try:
+            sleep(0.1)
+        finally:
+            actual = stop_tracking(ref)
+    finally:
+        child.kill()
+        child.wait()
+
+    for measure in (Measure.CPU_USED_PIDS_PERCENT, Measure.RAM_USED_PIDS_KB):
+        assert measure in actual.keys()
+        result_entry = actual[measure]
+        assert result_entry.value is not None
+        # The series are labeled by the IDs of the tracked processes.
+        assert f"labels: [{child.pid}]" in result_entry.value
+
+
 def test_measure_using_with_statement() -> None:
     with tracking([Measure.TIME_ELAPSED_WALL_CLOCK_MS]) as actual:
         sleep(0.1)
@@ -6,6 +6,7 @@ from ctypes import (
     c_char_p,
     c_size_t,
     c_void_p,
+    c_uint32,
     c_int,
     Structure,
     pointer,
@@ -122,6 +123,105 @@ class Measure(IntEnum):
     GIT_UNCOMMITTED_CHANGES = auto()
     GIT_UNPUSHED_CHANGES = auto()
     GIT_UNCHECKED_FILES = auto()
+    CPU_NUM_THREADS_PROCESS = auto()
+    CPU_USED_THREADS_PERCENT = auto()
+    CPU_TIME_THREADS_MS = auto()
+    CPU_THREADS_IMBALANCE = auto()
+    CPU_USED_CORES_PERCENT = auto()
+    CPU_FREQUENCY_CORES_MHZ = auto()
+    CPU_ACTIVE_CORES_SYSTEM = auto()
+    PERF_CYCLES = auto()
+    PERF_INSTRUCTIONS = auto()
+    PERF_CACHE_REFERENCES = auto()
+    PERF_CACHE_MISSES = auto()
+    PERF_BRANCH_MISSES = auto()
+    PERF_CONTEXT_SWITCHES = auto()
+    PERF_CPU_MIGRATIONS = auto()
+    PERF_PAGE_FAULTS = auto()
+    PERF_IPC = auto()
+    PERF_CACHE_MISS_PERCENT = auto()
+    IO_READ_PROCESS_BYTES = auto()
+    IO_WRITTEN_PROCESS_BYTES = auto()
+    IO_STORAGE_READ_PROCESS_BYTES = auto()
+    IO_STORAGE_WRITTEN_PROCESS_BYTES = auto()
+    IO_READ_CALLS_PROCESS = auto()
+    IO_WRITE_CALLS_PROCESS = auto()
+    IO_READ_RATE_PROCESS_KBPS = auto()
+    IO_WRITE_RATE_PROCESS_KBPS = auto()
+    IO_STORAGE_READ_RATE_PROCESS_KBPS = auto()
+    IO_STORAGE_WRITE_RATE_PROCESS_KBPS = auto()
+    PSI_CPU_SOME_PERMYRIAD = auto()
+    PSI_CPU_FULL_PERMYRIAD = auto()
+    PSI_MEMORY_SOME_PERMYRIAD = auto()
+    PSI_MEMORY_FULL_PERMYRIAD = auto()
+    PSI_IO_SOME_PERMYRIAD = auto()
+    PSI_IO_FULL_PERMYRIAD = auto()
+    PSI_CPU_SOME_STALL_MS = auto()
+    PSI_CPU_FULL_STALL_MS = auto()
+    PSI_MEMORY_SOME_STALL_MS = auto()
+    PSI_MEMORY_FULL_STALL_MS = auto()
+    PSI_IO_SOME_STALL_MS = auto()
+    PSI_IO_FULL_STALL_MS = auto()
+    RAM_PSS_PROCESS_KB = auto()
+    RAM_USS_PROCESS_KB = auto()
+    RAM_ANON_PROCESS_KB = auto()
+    RAM_FILE_PROCESS_KB = auto()
+    RAM_SHMEM_PROCESS_KB = auto()
+    RAM_SWAP_PROCESS_KB = auto()
+    RAM_HUGEPAGES_PROCESS_KB = auto()
+    PAGECACHE_START = auto()
+    PAGECACHE_STOP = auto()
+    PAGECACHE_RESIDENT_PERCENT = auto()
+    PAGECACHE_STATE = auto()
+    CPU_USED_PIDS_PERCENT = auto()
+    RAM_USED_PIDS_KB = auto()
+    PROCESS_TIMELINE = auto()
+    PROCESS_COUNT = auto()
+    CPU_IDLE_STATES = auto()
+    CPU_IDLE_PERCENT = auto()
+    CPU_THROTTLE_EVENTS = auto()
+    THERMAL_ZONES_CELSIUS = auto()
+    CPU_RUN_TIME_PROCESS_MS = auto()
+    CPU_WAIT_TIME_PROCESS_MS = auto()
+    CPU_TIMESLICES_PROCESS = auto()
+    CPU_WAIT_PROCESS_PERCENT = auto()
+    IO_BLOCK_DELAY_PROCESS_MS = auto()
+    ENERGY_DOMAINS_JOULES = auto()
+    POWER_DOMAINS_WATTS = auto()
+    CPU_ENERGY_PROCESS_JOULES = auto()
+    RAM_ENERGY_PROCESS_JOULES = auto()
+    CPU_ENERGY_ESTIMATED_JOULES = auto()
+    CPU_POWER_ESTIMATED_WATTS = auto()
+    CPU_POWER_MODEL = auto()
+    GPU_USED_DEVICES_PERCENT = auto()
+    GPU_USED_PROCESS_DEVICES_PERCENT = auto()
+    GPU_VRAM_USED_DEVICES_MB = auto()
+    GPU_VRAM_USED_PROCESS_DEVICES_MB = auto()
+    GPU_USED_SAMPLES_PERCENT = auto()
+    GPU_MEMORY_USED_SAMPLES_PERCENT = auto()
+    GPU_POWER_SAMPLES_WATTS = auto()
+    GPU_CLOCK_SM_MHZ = auto()
+    GPU_CLOCK_MEMORY_MHZ = auto()
+    GPU_POWER_WATTS = auto()
+    GPU_TEMPERATURE_CELSIUS = auto()
+    GPU_MEMORY_TEMPERATURE_CELSIUS = auto()
+    GPU_PCIE_TX_KBPS = auto()
+    GPU_PCIE_RX_KBPS = auto()
+    GPU_THROTTLE_REASONS = auto()
+    GIT_CHANGED_DURING_RUN = auto()
+    CPU_CORE_TYPES = auto()
+    CPU_CACHE_TOPOLOGY = auto()
+    CPU_NUMA_NODES = auto()
+    CPU_USED_CORE_TYPES_PERCENT = auto()
+    PSI_CPU_SOME_AVG10_PERMYRIAD = auto()
+    PSI_CPU_FULL_AVG10_PERMYRIAD = auto()
+    PSI_MEMORY_SOME_AVG10_PERMYRIAD = auto()
+    PSI_MEMORY_FULL_AVG10_PERMYRIAD = auto()
+    PSI_IO_SOME_AVG10_PERMYRIAD = auto()
+    PSI_IO_FULL_AVG10_PERMYRIAD = auto()
+    CPU_RUN_TIME_STEPS_PROCESS_MS = auto()
+    CPU_WAIT_TIME_STEPS_PROCESS_MS = auto()
+    CPU_TIMESLICES_STEPS_PROCESS = auto()
     PYTHON_VERSION = 1000
     PYTHON_EXECUTABLE = 1001
     PYTHON_ARGUMENTS = 1002
@@ -596,6 +696,16 @@ class _TirexTrackerLibrary(CDLL):
     tirexStartTracking: Callable[
         [Array[_MeasureConfiguration], int, Pointer[Pointer[_TrackingHandle]]], int
     ]
+    tirexStartTrackingPids: Callable[
+        [
+            Array[_MeasureConfiguration],
+            Optional[Array[c_uint32]],
+            int,
+            int,
+            Pointer[Pointer[_TrackingHandle]],
+        ],
+        int,
+    ]
     tirexStopTracking: Callable[[Pointer[_TrackingHandle], Pointer[Pointer[_Result]]], int]
     tirexSetLogCallback: Callable[[CFunctionType], None]
     tirexDataProviderGetAll: Callable[[Array[_ProviderInfo], int], int]
@@ -635,6 +745,14 @@ def _load_library() -> _TirexTrackerLibrary:
         POINTER(POINTER(_TrackingHandle)),
     ]
     library.tirexStartTracking.restype = c_int
+    library.tirexStartTrackingPids.argtypes = [
+        Array[_MeasureConfiguration],
+        POINTER(c_uint32),
+        c_size_t,
+        c_size_t,
+        POINTER(POINTER(_TrackingHandle)),
+    ]
+    library.tirexStartTrackingPids.restype = c_int
     library.tirexStopTracking.argtypes = [
         POINTER(_TrackingHandle),
         POINTER(POINTER(_Result)),
@@ -770,6 +888,7 @@ class TrackingHandle(
         system_description: Optional[str] = None,
         export_file_path: Optional[PathLike[str]] = None,
         export_format: Optional[ExportFormat] = None,
+        pids: Optional[Collection[int]] = None,
     ) -> Self:
         # Get Python info first, and then strip Python measures from the list.
         python_info, measures = _get_python_info(measures=measures)
@@ -783,11 +902,21 @@ class TrackingHandle(
         _handle_error(error_int)
         fetch_info_result = result_pointer.contents
 
-        # Start the tracking.
+        # Start the tracking (of the given processes or, if there are none, of this process).
         tracking_handle_pointer = pointer(pointer(_TrackingHandle()))
-        error_int = _LIBRARY.tirexStartTracking(
-            configs_array, poll_intervall_ms, tracking_handle_pointer
-        )
+        if pids:
+            pids_array = (c_uint32 * len(pids))(*pids)
+            error_int = _LIBRARY.tirexStartTrackingPids(
+                configs_array,
+                pids_array,
+                len(pids),
+                poll_intervall_ms,
+                tracking_handle_pointer,
+            )
+        else:
+            error_int = _LIBRARY.tirexStartTracking(
+                configs_array, poll_intervall_ms, tracking_handle_pointer
+            )
         _handle_error(error_int)
         tracking_handle = tracking_handle_pointer.contents
 
@@ -955,6 +1084,7 @@ def start_tracking(
     system_description: Optional[str] = None,
     export_file_path: Optional[PathLike[str]] = None,
     export_format: Optional[ExportFormat] = None,
+    pids: Optional[Collection[int]] = None,
 ) -> TrackingHandle:
     return TrackingHandle.start(
         measures=measures,
@@ -963,6 +1093,7 @@ def start_tracking(
         system_description=system_description,
         export_file_path=export_file_path,
         export_format=export_format,
+        pids=pids,
     )
 
 
@@ -980,6 +1111,7 @@ def tracking(
     system_description: Optional[str] = None,
     export_file_path: Optional[PathLike[str]] = None,
     export_format: Optional[ExportFormat] = None,
+    pids: Optional[Collection[int]] = None,
 ) -> TrackingHandle:
     return TrackingHandle.start(
         measures=measures,
@@ -988,6 +1120,7 @@ def tracking(
         system_description=system_description,
         export_file_path=export_file_path,
         export_format=export_format,
+        pids=pids,
     )
 
 